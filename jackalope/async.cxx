@@ -21,6 +21,8 @@ namespace jackalope {
 
 static pool_map_t<string_t, string_t> async_config;
 static weak_t<async_engine_t> async_engine_cache;
+static pool_list_t<weak_t<async_engine_t>> async_engines;
+static real_t async_admission_load = JACKALOPE_ASYNC_ADMISSION_LOAD;
 
 static lock_t get_async_lock()
 {
@@ -39,11 +41,46 @@ size_t async_engine_t::detect_num_threads()
     return num_threads;
 }
 
+// must be called with the async lock held
+static void register_async_engine(shared_t<async_engine_t> engine_in)
+{
+    async_engines.remove_if([](const weak_t<async_engine_t>& engine_in) { return engine_in.expired(); });
+    async_engines.push_back(engine_in);
+}
+
 shared_t<async_engine_t> async_engine_t::make(const init_args_t& init_args_in)
 {
     return jackalope::make_shared<async_engine_t>(init_args_in);
 }
 
+shared_t<async_engine_t> async_engine_t::admit(const init_args_t& init_args_in)
+{
+    auto lock = get_async_lock();
+
+    real_t busy_threads = 0;
+
+    for(auto& i : async_engines) {
+        auto engine = i.lock();
+
+        if (engine != nullptr) {
+            busy_threads += engine->get_load() * engine->get_num_threads();
+        }
+    }
+
+    auto capacity = detect_num_threads();
+
+    if (busy_threads > capacity * async_admission_load) {
+        throw_runtime_error("async engines are too busy to admit another: ", busy_threads, " of ", capacity, " threads in use");
+    }
+
+    log_info("admitting async engine with ", busy_threads, " of ", capacity, " threads in use");
+
+    auto engine = make(init_args_in);
+    register_async_engine(engine);
+
+    return engine;
+}
+
 async_engine_t::async_engine_t(const init_args_t& init_args_in)
 {
     add_property(JACKALOPE_ASYNC_PROPERTY_THREADS, property_t::type_t::size);
@@ -58,6 +95,8 @@ async_engine_t::async_engine_t(const init_args_t& init_args_in)
         threads_property->set(detect_num_threads());
     }
 
+    num_threads = threads_property->get_size();
+
     asio_work = new boost::asio::io_service::work(asio_io);
 
     init_threads();
@@ -100,7 +139,211 @@ void async_engine_t::asio_thread()
 
 void async_engine_t::submit_job(async_job_t<void> job_in)
 {
-    asio_io.post(job_in);
+    asio_io.post([this, job_in] {
+        auto start = std::chrono::steady_clock::now();
+
+        job_in();
+
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        busy_nanoseconds += std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+    });
+}
+
+bool async_engine_t::poll_one()
+{
+    return asio_io.poll_one() > 0;
+}
+
+size_t async_engine_t::get_num_threads()
+{
+    return num_threads;
+}
+
+real_t async_engine_t::get_load()
+{
+    lock_t lock(load_mutex);
+
+    auto now = std::chrono::steady_clock::now();
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(now - load_sample_time).count();
+
+    // too short of a window to say anything new
+    if (elapsed < 1000000) {
+        return load;
+    }
+
+    auto busy = busy_nanoseconds.load();
+
+    load = static_cast<real_t>(busy - load_sample_busy) / (static_cast<real_t>(elapsed) * num_threads);
+    load_sample_busy = busy;
+    load_sample_time = now;
+
+    return load;
+}
+
+async_join_t::async_join_t(shared_t<async_engine_t> engine_in)
+: engine(engine_in), state(jackalope::make_shared<state_t>())
+{
+    assert(engine != nullptr);
+}
+
+size_t async_join_t::add_job(async_job_t<void> job_in)
+{
+    auto& task = state->tasks.emplace_back();
+    task.job = job_in;
+
+    return state->tasks.size() - 1;
+}
+
+void async_join_t::add_dependency(const size_t job_in, const size_t depends_on_in)
+{
+    assert(job_in < state->tasks.size());
+    assert(depends_on_in < state->tasks.size());
+
+    if (job_in == depends_on_in) {
+        return;
+    }
+
+    state->tasks[depends_on_in].dependents.push_back(job_in);
+    state->tasks[job_in].waiting++;
+}
+
+// must be called with the state mutex held
+void async_join_t::queue_task(state_t& state_in, const size_t task_in)
+{
+    auto& task = state_in.tasks[task_in];
+
+    assert(! task.queued);
+
+    task.queued = true;
+    state_in.ready.push_back(task_in);
+}
+
+// must be called with the state mutex held
+void async_join_t::submit_helpers(shared_t<async_engine_t> engine_in, shared_t<state_t> state_in)
+{
+    // the thread that queued the tasks takes one of them itself
+    auto wanted = state_in->ready.size() > 0 ? state_in->ready.size() - 1 : 0;
+
+    while(wanted > 0 && state_in->num_helpers < state_in->max_helpers) {
+        state_in->num_helpers++;
+        wanted--;
+
+        engine_in->submit_job([engine_in, state_in] {
+            run_tasks(engine_in, state_in, true);
+        });
+    }
+}
+
+void async_join_t::run_tasks(shared_t<async_engine_t> engine_in, shared_t<state_t> state_in, const bool is_helper_in)
+{
+    lock_t lock(state_in->mutex);
+    auto total = state_in->tasks.size();
+
+    while(state_in->num_finished < total) {
+        if (state_in->error != nullptr) {
+            // nothing new starts after a failure; the remaining tasks
+            // count as finished once the running ones are done
+            if (state_in->num_running == 0) {
+                state_in->num_finished = total;
+                state_in->ready.clear();
+                break;
+            }
+        } else if (state_in->ready.size() > 0) {
+            auto task_num = state_in->ready.front();
+            state_in->ready.pop_front();
+            state_in->num_running++;
+
+            auto job = state_in->tasks[task_num].job;
+            std::exception_ptr error = nullptr;
+
+            lock.unlock();
+
+            try {
+                job();
+            } catch (...) {
+                error = std::current_exception();
+            }
+
+            lock.lock();
+
+            state_in->num_running--;
+            state_in->num_finished++;
+
+            if (error != nullptr && state_in->error == nullptr) {
+                state_in->error = error;
+            }
+
+            for(auto i : state_in->tasks[task_num].dependents) {
+                auto& dependent = state_in->tasks[i];
+
+                if (dependent.waiting > 0 && --dependent.waiting == 0 && ! dependent.queued) {
+                    queue_task(*state_in, i);
+                }
+            }
+
+            submit_helpers(engine_in, state_in);
+            state_in->done_cond.notify_all();
+
+            continue;
+        } else if (state_in->num_running == 0) {
+            // every task that is left waits on another one so there is
+            // a cycle; it is broken by letting the first of them go
+            for(size_t i = 0; i < total; i++) {
+                auto& task = state_in->tasks[i];
+
+                if (! task.queued) {
+                    task.waiting = 0;
+                    queue_task(*state_in, i);
+                    break;
+                }
+            }
+
+            continue;
+        }
+
+        // helpers never wait so they do not hold on to engine threads
+        if (is_helper_in) {
+            break;
+        }
+
+        state_in->done_cond.wait(lock);
+    }
+
+    if (is_helper_in) {
+        state_in->num_helpers--;
+    }
+
+    state_in->done_cond.notify_all();
+}
+
+void async_join_t::run()
+{
+    {
+        lock_t lock(state->mutex);
+
+        state->max_helpers = engine->get_num_threads();
+
+        for(size_t i = 0; i < state->tasks.size(); i++) {
+            if (state->tasks[i].waiting == 0) {
+                queue_task(*state, i);
+            }
+        }
+
+        submit_helpers(engine, state);
+    }
+
+    run_tasks(engine, state, false);
+
+    std::exception_ptr error = nullptr;
+
+    {
+        lock_t lock(state->mutex);
+        error = state->error;
+    }
+
+    if (error != nullptr) {
+        std::rethrow_exception(error);
+    }
 }
 
 void set_async_config(const string_t& name_in, const string_t& value_in)
@@ -114,6 +357,13 @@ void set_async_config(const string_t& name_in, const string_t& value_in)
     async_config[name_in] = value_in;
 }
 
+void set_async_admission_load(const real_t load_in)
+{
+    auto lock = get_async_lock();
+
+    async_admission_load = load_in;
+}
+
 shared_t<async_engine_t> get_async_engine()
 {
     auto lock = get_async_lock();
@@ -125,6 +375,7 @@ shared_t<async_engine_t> get_async_engine()
             if (async_engine_cache.expired()) {
                 auto init_args = make_init_args(async_config);
                 async_engine_cache = engine = async_engine_t::make(init_args);
+                register_async_engine(engine);
             } else {
                 engine = async_engine_cache.lock();
             }
@@ -14,6 +14,8 @@
 #pragma once
 
 #include <boost/asio.hpp>
+#include <chrono>
+#include <exception>
 
 #include <jackalope/property.h>
 #include <jackalope/string.h>
@@ -22,6 +24,9 @@
 
 #define JACKALOPE_ASYNC_PROPERTY_NAME "name"
 #define JACKALOPE_ASYNC_PROPERTY_THREADS "threads"
+// new engines are refused while the live engines are using more
+// than this fraction of the hardware threads
+#define JACKALOPE_ASYNC_ADMISSION_LOAD 0.8
 
 namespace jackalope {
 
@@ -35,6 +40,11 @@ protected:
     boost::asio::io_service::work * asio_work = nullptr;
     pool_list_t<thread_t> asio_threads;
     size_t num_threads = 0;
+    atomic_t<uint64_t> busy_nanoseconds = ATOMIC_VAR_INIT(0);
+    mutex_t load_mutex;
+    uint64_t load_sample_busy = 0;
+    std::chrono::steady_clock::time_point load_sample_time = std::chrono::steady_clock::now();
+    real_t load = 0;
 
     virtual void init_threads();
     virtual void asio_thread();
@@ -42,12 +52,66 @@ protected:
 public:
     static size_t detect_num_threads();
     static shared_t<async_engine_t> make(const init_args_t& init_args_in);
+    // makes an engine that is not shared if the measured load of the
+    // engines that exist leaves room for it
+    static shared_t<async_engine_t> admit(const init_args_t& init_args_in);
     async_engine_t(const init_args_t& init_args_in);
     virtual ~async_engine_t();
     void submit_job(async_job_t<void> job_in);
+    // runs one job that is ready on the calling thread and returns
+    // false if there was none; a job can call this to keep the engine
+    // going while it waits on other jobs
+    bool poll_one();
+    size_t get_num_threads();
+    // fraction of the engine threads spent running jobs since the
+    // last time the load was sampled
+    real_t get_load();
 };
 
-void set_async_config(const string_t& value_in);
+// runs a set of jobs on an engine where a job only starts once the
+// jobs it depends on are done; the thread calling run() runs jobs as
+// well so it is safe to use from inside a job on the same engine
+class async_join_t : public base_t {
+
+protected:
+    struct task_t {
+        async_job_t<void> job;
+        pool_vector_t<size_t> dependents;
+        size_t waiting = 0;
+        bool queued = false;
+    };
+
+    struct state_t {
+        mutex_t mutex;
+        condition_t done_cond;
+        pool_vector_t<task_t> tasks;
+        pool_list_t<size_t> ready;
+        size_t num_finished = 0;
+        size_t num_running = 0;
+        size_t num_helpers = 0;
+        size_t max_helpers = 0;
+        std::exception_ptr error = nullptr;
+    };
+
+    shared_t<async_engine_t> engine;
+    shared_t<state_t> state;
+
+    static void queue_task(state_t& state_in, const size_t task_in);
+    static void submit_helpers(shared_t<async_engine_t> engine_in, shared_t<state_t> state_in);
+    static void run_tasks(shared_t<async_engine_t> engine_in, shared_t<state_t> state_in, const bool is_helper_in);
+
+public:
+    async_join_t(shared_t<async_engine_t> engine_in);
+    size_t add_job(async_job_t<void> job_in);
+    void add_dependency(const size_t job_in, const size_t depends_on_in);
+    // returns when every job is done; if a job throws no more jobs are
+    // started and the first exception is rethrown once the running
+    // jobs finish
+    void run();
+};
+
+void set_async_config(const string_t& name_in, const string_t& value_in);
+void set_async_admission_load(const real_t load_in);
 shared_t<async_engine_t> get_async_engine();
 
 } // namespace jackalope
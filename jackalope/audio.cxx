@@ -15,7 +15,14 @@
 
 #include <jackalope/async.h>
 #include <jackalope/audio.h>
+#include <jackalope/audio/convolve.h>
+#include <jackalope/audio/eq.h>
 #include <jackalope/audio/gain.h>
+#include <jackalope/audio/lfo.h>
+#include <jackalope/audio/meter.h>
+#include <jackalope/audio/mix.h>
+#include <jackalope/audio/reblock.h>
+#include <jackalope/audio/resample.h>
 #include <jackalope/node.h>
 #include <jackalope/pcm.h>
 
@@ -56,7 +63,14 @@ void audio_init()
     add_source_constructor(JACKALOPE_TYPE_AUDIO, audio_source_constructor);
     add_sink_constructor(JACKALOPE_TYPE_AUDIO, audio_sink_constructor);
 
+    audio::convolve_init();
+    audio::eq_init();
     audio::gain_init();
+    audio::lfo_init();
+    audio::meter_init();
+    audio::mix_init();
+    audio::reblock_init();
+    audio::resample_init();
 
 #ifdef CONFIG_ENABLE_JACKAUDIO
     audio::jackaudio_init();
@@ -128,13 +142,46 @@ void audio_link_t::reset()
     source->link_available(shared_obj());
 }
 
+bool audio_link_t::supports_delay()
+{
+    return true;
+}
+
+void audio_link_t::set_delay(const size_t delay_in)
+{
+    auto lock = get_object_lock();
+
+    delay = delay_in;
+    delay_line.clear();
+
+    pool_vector_t<real_t> silence(delay, 0);
+    delay_line.write(silence.data(), delay);
+}
+
+size_t audio_link_t::get_delay()
+{
+    auto lock = get_object_lock();
+
+    return delay;
+}
+
 void audio_link_t::set_buffer(shared_t<audio_buffer_t> buffer_in)
 {
     auto lock = get_object_lock();
 
     assert(buffer == nullptr);
 
-    buffer = buffer_in;
+    if (delay == 0) {
+        buffer = buffer_in;
+        return;
+    }
+
+    // the buffer from the source can be shared with other
+    // links so the delayed copy is a new buffer
+    auto num_samples = buffer_in->num_samples;
+    buffer = jackalope::make_shared<audio_buffer_t>(num_samples);
+    delay_line.write(buffer_in->get_pointer(), num_samples);
+    delay_line.read(buffer->get_pointer(), num_samples);
 }
 
 shared_t<audio_buffer_t> audio_link_t::get_buffer()
@@ -146,6 +193,35 @@ shared_t<audio_buffer_t> audio_link_t::get_buffer()
     return buffer;
 }
 
+// the source can not send again while this link holds the block so the
+// new link is only busy if it was made busy some other way
+void audio_link_t::transfer(shared_t<link_t> link_in)
+{
+    auto target = dynamic_pointer_cast<audio_link_t>(link_in);
+
+    assert(target != nullptr);
+
+    auto moved = guard_lockable({
+        if (buffer == nullptr) {
+            return false;
+        }
+
+        auto available = target->is_available();
+
+        if (available) {
+            target->set_buffer(buffer);
+        }
+
+        buffer = nullptr;
+
+        return available;
+    });
+
+    if (moved) {
+        link_in->get_to()->get_parent()->send_message<link_ready_message_t>(link_in);
+    }
+}
+
 audio_source_t::audio_source_t(const string_t name_in, shared_t<object_t> parent_in)
 : source_t(name_in, JACKALOPE_TYPE_AUDIO, parent_in)
 { }
@@ -221,9 +297,24 @@ shared_t<audio_buffer_t> audio_sink_t::_get_buffer()
     } else if (links_size == 1) {
         auto audio_link = links.front()->shared_obj<audio_link_t>();
         return audio_link->get_buffer();
-    } else {
-        throw_runtime_error("can't handle more than 1 link");
     }
+
+    // the link buffers may be shared with other sinks so
+    // the sum goes into a new buffer
+    auto mixed = jackalope::make_shared<audio_buffer_t>(buffer_size);
+    auto mixed_pointer = mixed->get_pointer();
+
+    for(auto& i : links) {
+        auto link_buffer = i->shared_obj<audio_link_t>()->get_buffer();
+
+        if (link_buffer->num_samples != buffer_size) {
+            throw_runtime_error("link buffer size did not match sink buffer size: ", link_buffer->num_samples, " != ", buffer_size);
+        }
+
+        pcm_add(link_buffer->get_pointer(), mixed_pointer, buffer_size);
+    }
+
+    return mixed;
 }
 
 // a sink is ready if none
@@ -262,7 +353,7 @@ void audio_sink_t::_reset()
 
     auto parent = get_parent();
 
-    log_info("(", parent->description(), ") reseting sink: ", name);
+    log_trace("(", parent->description(), ") reseting sink: ", name);
 
     for(auto i : links) {
         auto link = i->shared_obj<audio_link_t>();
@@ -40,14 +40,20 @@ class audio_link_t : public link_t, lockable_t {
 
 protected:
     shared_t<audio_buffer_t> buffer = nullptr;
+    size_t delay = 0;
+    pcm_ring_t<real_t> delay_line;
 
 public:
     audio_link_t(shared_t<source_t> from_in, shared_t<sink_t> to_in);
+    virtual bool supports_delay() override;
+    virtual void set_delay(const size_t delay_in) override;
+    virtual size_t get_delay() override;
     virtual void reset();
     virtual bool is_available() override;
     virtual bool is_ready() override;
     virtual shared_t<audio_buffer_t> get_buffer();
     virtual void set_buffer(shared_t<audio_buffer_t> buffer_in);
+    virtual void transfer(shared_t<link_t> link_in) override;
 };
 
 class audio_source_t : public source_t {
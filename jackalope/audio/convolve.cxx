@@ -0,0 +1,237 @@
+// Jackalope Audio Engine
+// Copyright 2019 Tyler Riddle <kg7oem@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+
+#include <jackalope/audio.h>
+#include <jackalope/audio/convolve.h>
+#include <jackalope/exception.h>
+
+#ifdef CONFIG_ENABLE_SNDFILE
+#include <jackalope/audio/sndfile.h>
+#endif
+
+namespace jackalope {
+
+namespace audio {
+
+static shared_t<convolve_node_t> convolve_node_constructor(NDEBUG_UNUSED const string_t& type_in, const init_args_t init_args_in)
+{
+    assert(type_in == JACKALOPE_AUDIO_CONVOLVE_OBJECT_TYPE);
+
+    return jackalope::make_shared<convolve_node_t>(init_args_in);
+}
+
+void convolve_init()
+{
+    add_object_constructor(JACKALOPE_AUDIO_CONVOLVE_OBJECT_TYPE, convolve_node_constructor);
+}
+
+static mutex_t ir_cache_mutex;
+static pool_map_t<string_t, weak_t<convolve_ir_t>> ir_cache;
+
+#ifdef CONFIG_ENABLE_SNDFILE
+static pool_vector_t<real_t> load_ir(const string_t& path_in, const size_t channel_in)
+{
+    sndfile_info_t info;
+    auto file = sndfile::sf_open(path_in.c_str(), sndfile::SFM_READ, &info);
+
+    if (file == nullptr) {
+        throw_runtime_error("Could not open ", path_in, ": ", sndfile::sf_strerror(nullptr));
+    }
+
+    size_t num_channels = info.channels;
+
+    if (channel_in >= num_channels) {
+        sndfile::sf_close(file);
+        throw_runtime_error("impulse response channel ", channel_in, " does not exist in ", path_in);
+    }
+
+    pool_vector_t<real_t> interleaved(info.frames * num_channels);
+    size_t frames_read = sndfile::sf_readf_float(file, interleaved.data(), info.frames);
+    sndfile::sf_close(file);
+
+    pool_vector_t<real_t> ir(frames_read);
+    pcm_extract_interleave(interleaved.data(), ir.data(), channel_in, num_channels, frames_read);
+
+    return ir;
+}
+#else
+static pool_vector_t<real_t> load_ir(const string_t& path_in, const size_t)
+{
+    throw_runtime_error("can not load impulse response with out sndfile support: ", path_in);
+}
+#endif
+
+shared_t<convolve_ir_t> get_convolve_ir(const string_t& path_in, const size_t channel_in, const size_t block_size_in)
+{
+    lock_t lock(ir_cache_mutex);
+
+    auto key = to_string(path_in, ":", channel_in, ":", block_size_in);
+    auto found = ir_cache.find(key);
+
+    if (found != ir_cache.end()) {
+        auto ir = found->second.lock();
+
+        if (ir != nullptr) {
+            return ir;
+        }
+    }
+
+    auto samples = load_ir(path_in, channel_in);
+    auto ir = jackalope::make_shared<convolve_ir_t>(samples.data(), samples.size(), block_size_in);
+    ir_cache[key] = ir;
+
+    return ir;
+}
+
+convolve_ir_t::convolve_ir_t(const real_t * ir_in, const size_t ir_length_in, const size_t block_size_in)
+: block_size(block_size_in), fft(get_fft(block_size_in * 2))
+{
+    if (ir_length_in == 0) {
+        throw_runtime_error("impulse response is empty");
+    }
+
+    num_partitions = (ir_length_in + block_size - 1) / block_size;
+    partitions.assign(num_partitions * fft->size, 0);
+
+    for(size_t p = 0; p < num_partitions; p++) {
+        auto partition = partitions.data() + p * fft->size;
+        auto offset = p * block_size;
+        auto length = std::min(block_size, ir_length_in - offset);
+
+        for(size_t i = 0; i < length; i++) {
+            partition[i] = ir_in[offset + i];
+        }
+
+        fft->forward(partition);
+    }
+}
+
+convolver_t::convolver_t(shared_t<convolve_ir_t> ir_in)
+: ir(ir_in), block_size(ir_in->block_size)
+{
+    previous.assign(ir->block_size, 0);
+    history.assign(ir->num_partitions * ir->fft->size, 0);
+    work.resize(ir->fft->size);
+    sum.resize(ir->fft->size);
+}
+
+void convolver_t::process(const real_t * input_in, real_t * output_in)
+{
+    auto fft_size = ir->fft->size;
+    auto num_partitions = ir->num_partitions;
+
+    // the input spectrum covers the previous block and this block
+    for(size_t i = 0; i < block_size; i++) {
+        work[i] = previous[i];
+        work[block_size + i] = input_in[i];
+    }
+
+    pcm_copy(input_in, previous.data(), block_size);
+    ir->fft->forward(work.data());
+
+    // the history is a ring of input spectra with the newest at
+    // history_position
+    history_position = (history_position + num_partitions - 1) % num_partitions;
+    std::copy(work.begin(), work.end(), history.begin() + history_position * fft_size);
+
+    std::fill(sum.begin(), sum.end(), complex_t(0));
+
+    for(size_t p = 0; p < num_partitions; p++) {
+        auto slot = (history_position + p) % num_partitions;
+        spectrum_multiply_add(history.data() + slot * fft_size, ir->partitions.data() + p * fft_size, sum.data(), fft_size);
+    }
+
+    ir->fft->inverse(sum.data());
+
+    for(size_t i = 0; i < block_size; i++) {
+        output_in[i] = sum[block_size + i].real();
+    }
+}
+
+convolve_node_t::convolve_node_t(const init_args_t init_args_in)
+: filter_plugin_t(init_args_in)
+{ }
+
+convolve_node_t::~convolve_node_t()
+{
+    if (convolver != nullptr) {
+        delete convolver;
+        convolver = nullptr;
+    }
+}
+
+void convolve_node_t::init()
+{
+    assert_lockable_owner();
+
+    add_property(JACKALOPE_PROPERTY_PCM_BUFFER_SIZE, property_t::type_t::size, init_args);
+    add_property(JACKALOPE_PROPERTY_PCM_SAMPLE_RATE, property_t::type_t::size, init_args);
+    add_property(JACKALOPE_AUDIO_CONVOLVE_PROPERTY_PATH, property_t::type_t::string, init_args);
+    add_property(JACKALOPE_AUDIO_CONVOLVE_PROPERTY_CHANNEL, property_t::type_t::size, init_args);
+
+    filter_plugin_t::init();
+}
+
+void convolve_node_t::activate()
+{
+    assert_lockable_owner();
+
+    for (auto i : { JACKALOPE_PROPERTY_PCM_SAMPLE_RATE, JACKALOPE_PROPERTY_PCM_BUFFER_SIZE }) {
+        set_undef_property(i);
+    }
+
+    auto path_property = get_property(JACKALOPE_AUDIO_CONVOLVE_PROPERTY_PATH);
+    auto channel_property = get_property(JACKALOPE_AUDIO_CONVOLVE_PROPERTY_CHANNEL);
+
+    if (! path_property->is_defined()) {
+        throw_runtime_error("convolve node requires ", JACKALOPE_AUDIO_CONVOLVE_PROPERTY_PATH);
+    }
+
+    if (! channel_property->is_defined()) {
+        channel_property->set(0);
+    }
+
+    auto buffer_size = get_property(JACKALOPE_PROPERTY_PCM_BUFFER_SIZE)->get_size();
+    auto ir = get_convolve_ir(path_property->get_string(), channel_property->get_size(), buffer_size);
+    convolver = new convolver_t(ir);
+
+    add_sink("input", JACKALOPE_TYPE_AUDIO);
+    add_source("output", JACKALOPE_TYPE_AUDIO);
+
+    filter_plugin_t::activate();
+}
+
+void convolve_node_t::execute()
+{
+    assert_lockable_owner();
+
+    auto sink = get_sink<audio_sink_t>(0);
+    auto source = get_source<audio_source_t>(0);
+
+    auto input_buffer = sink->get_buffer();
+
+    if (input_buffer->num_samples != convolver->block_size) {
+        throw_runtime_error("convolve input buffer size did not match block size: ", input_buffer->num_samples);
+    }
+
+    auto output_buffer = jackalope::make_shared<audio_buffer_t>(input_buffer->num_samples);
+
+    convolver->process(input_buffer->get_pointer(), output_buffer->get_pointer());
+    sink->reset();
+
+    source->notify_buffer(output_buffer);
+}
+
+} // namespace audio
+
+} //namespace jackalope
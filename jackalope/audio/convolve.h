@@ -0,0 +1,80 @@
+// Jackalope Audio Engine
+// Copyright 2019 Tyler Riddle <kg7oem@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+
+#pragma once
+
+#include <jackalope/fft.h>
+#include <jackalope/plugin.h>
+#include <jackalope/types.h>
+
+#define JACKALOPE_AUDIO_CONVOLVE_OBJECT_TYPE        "audio::convolve"
+#define JACKALOPE_AUDIO_CONVOLVE_PROPERTY_PATH      "config.path"
+#define JACKALOPE_AUDIO_CONVOLVE_PROPERTY_CHANNEL   "config.channel"
+
+namespace jackalope {
+
+namespace audio {
+
+void convolve_init();
+
+// an impulse response split into block sized partitions and stored in
+// the frequency domain
+struct convolve_ir_t : public base_t {
+    const size_t block_size;
+    const shared_t<fft_t> fft;
+    size_t num_partitions = 0;
+    pool_vector_t<complex_t> partitions;
+
+    convolve_ir_t(const real_t * ir_in, const size_t ir_length_in, const size_t block_size_in);
+};
+
+// impulse responses are shared by every node using the same
+// file, channel and block size
+shared_t<convolve_ir_t> get_convolve_ir(const string_t& path_in, const size_t channel_in, const size_t block_size_in);
+
+// uniformly partitioned overlap-save convolution
+class convolver_t : public base_t {
+
+protected:
+    const shared_t<convolve_ir_t> ir;
+    pool_vector_t<real_t> previous;
+    pool_vector_t<complex_t> history;
+    size_t history_position = 0;
+    pool_vector_t<complex_t> work;
+    pool_vector_t<complex_t> sum;
+
+public:
+    const size_t block_size;
+
+    convolver_t(shared_t<convolve_ir_t> ir_in);
+    // input and output are block_size samples
+    void process(const real_t * input_in, real_t * output_in);
+};
+
+class convolve_node_t : public filter_plugin_t {
+
+protected:
+    convolver_t * convolver = nullptr;
+
+public:
+    convolve_node_t(const init_args_t init_args_in);
+    virtual ~convolve_node_t();
+
+    virtual void init() override;
+    virtual void activate() override;
+    virtual void execute() override;
+};
+
+} // namespace audio
+
+} //namespace jackalope
@@ -0,0 +1,298 @@
+// Jackalope Audio Engine
+// Copyright 2019 Tyler Riddle <kg7oem@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+
+#include <cmath>
+
+#include <jackalope/audio.h>
+#include <jackalope/audio/eq.h>
+#include <jackalope/exception.h>
+
+namespace jackalope {
+
+namespace audio {
+
+static shared_t<eq_node_t> eq_node_constructor(NDEBUG_UNUSED const string_t& type_in, const init_args_t init_args_in)
+{
+    assert(type_in == JACKALOPE_AUDIO_EQ_OBJECT_TYPE);
+
+    return jackalope::make_shared<eq_node_t>(init_args_in);
+}
+
+void eq_init()
+{
+    add_object_constructor(JACKALOPE_AUDIO_EQ_OBJECT_TYPE, eq_node_constructor);
+}
+
+// from the Audio EQ Cookbook by Robert Bristow-Johnson
+biquad_coefficients_t make_biquad(const string_t& type_in, const size_t sample_rate_in, const real_t frequency_in, const real_t q_in, const real_t gain_in)
+{
+    if (sample_rate_in == 0) {
+        throw_runtime_error("biquad sample rate must not be 0");
+    }
+
+    if (q_in <= 0) {
+        throw_runtime_error("biquad Q must be greater than 0");
+    }
+
+    double a = std::pow(10.0, gain_in / 40.0);
+    double w0 = 2 * M_PI * frequency_in / sample_rate_in;
+    double cos_w0 = std::cos(w0);
+    double alpha = std::sin(w0) / (2 * q_in);
+    double b0, b1, b2, a0, a1, a2;
+
+    if (type_in == "lowpass") {
+        b0 = (1 - cos_w0) / 2; b1 = 1 - cos_w0; b2 = (1 - cos_w0) / 2;
+        a0 = 1 + alpha; a1 = -2 * cos_w0; a2 = 1 - alpha;
+    } else if (type_in == "highpass") {
+        b0 = (1 + cos_w0) / 2; b1 = -(1 + cos_w0); b2 = (1 + cos_w0) / 2;
+        a0 = 1 + alpha; a1 = -2 * cos_w0; a2 = 1 - alpha;
+    } else if (type_in == "bandpass") {
+        b0 = alpha; b1 = 0; b2 = -alpha;
+        a0 = 1 + alpha; a1 = -2 * cos_w0; a2 = 1 - alpha;
+    } else if (type_in == "notch") {
+        b0 = 1; b1 = -2 * cos_w0; b2 = 1;
+        a0 = 1 + alpha; a1 = -2 * cos_w0; a2 = 1 - alpha;
+    } else if (type_in == "peak") {
+        b0 = 1 + alpha * a; b1 = -2 * cos_w0; b2 = 1 - alpha * a;
+        a0 = 1 + alpha / a; a1 = -2 * cos_w0; a2 = 1 - alpha / a;
+    } else if (type_in == "lowshelf") {
+        double sqrt_a = 2 * std::sqrt(a) * alpha;
+        b0 = a * ((a + 1) - (a - 1) * cos_w0 + sqrt_a);
+        b1 = 2 * a * ((a - 1) - (a + 1) * cos_w0);
+        b2 = a * ((a + 1) - (a - 1) * cos_w0 - sqrt_a);
+        a0 = (a + 1) + (a - 1) * cos_w0 + sqrt_a;
+        a1 = -2 * ((a - 1) + (a + 1) * cos_w0);
+        a2 = (a + 1) + (a - 1) * cos_w0 - sqrt_a;
+    } else if (type_in == "highshelf") {
+        double sqrt_a = 2 * std::sqrt(a) * alpha;
+        b0 = a * ((a + 1) + (a - 1) * cos_w0 + sqrt_a);
+        b1 = -2 * a * ((a - 1) + (a + 1) * cos_w0);
+        b2 = a * ((a + 1) + (a - 1) * cos_w0 - sqrt_a);
+        a0 = (a + 1) - (a - 1) * cos_w0 + sqrt_a;
+        a1 = 2 * ((a - 1) - (a + 1) * cos_w0);
+        a2 = (a + 1) - (a - 1) * cos_w0 - sqrt_a;
+    } else {
+        throw_runtime_error("unknown biquad type: ", type_in);
+    }
+
+    biquad_coefficients_t coefficients;
+    coefficients.b0 = b0 / a0;
+    coefficients.b1 = b1 / a0;
+    coefficients.b2 = b2 / a0;
+    coefficients.a1 = a1 / a0;
+    coefficients.a2 = a2 / a0;
+
+    return coefficients;
+}
+
+biquad_bank_t::biquad_bank_t(const size_t num_channels_in, const size_t num_bands_in)
+: num_channels(num_channels_in), num_bands(num_bands_in)
+{
+    coefficients.resize(num_bands);
+    z1.assign(num_bands * num_channels, 0);
+    z2.assign(num_bands * num_channels, 0);
+}
+
+void biquad_bank_t::set_band(const size_t band_in, const biquad_coefficients_t& coefficients_in)
+{
+    if (band_in >= num_bands) {
+        throw_runtime_error("biquad band is out of bounds: ", band_in);
+    }
+
+    coefficients[band_in] = coefficients_in;
+}
+
+// transposed direct form II; the inner loop runs over the channels so
+// it can be vectorized
+void biquad_bank_t::process(real_t * frames_in, const size_t num_frames_in)
+{
+    for(size_t frame = 0; frame < num_frames_in; frame++) {
+        auto samples = frames_in + frame * num_channels;
+
+        for(size_t band = 0; band < num_bands; band++) {
+            const auto& c = coefficients[band];
+            auto band_z1 = z1.data() + band * num_channels;
+            auto band_z2 = z2.data() + band * num_channels;
+
+            for(size_t channel = 0; channel < num_channels; channel++) {
+                auto x = samples[channel];
+                auto y = c.b0 * x + band_z1[channel];
+
+                band_z1[channel] = c.b1 * x - c.a1 * y + band_z2[channel];
+                band_z2[channel] = c.b2 * x - c.a2 * y;
+                samples[channel] = y;
+            }
+        }
+    }
+}
+
+eq_node_t::eq_node_t(const init_args_t init_args_in)
+: filter_plugin_t(init_args_in)
+{ }
+
+eq_node_t::~eq_node_t()
+{
+    if (bank != nullptr) {
+        delete bank;
+        bank = nullptr;
+    }
+}
+
+void eq_node_t::init()
+{
+    assert_lockable_owner();
+
+    add_property(JACKALOPE_PROPERTY_PCM_BUFFER_SIZE, property_t::type_t::size, init_args);
+    add_property(JACKALOPE_PROPERTY_PCM_SAMPLE_RATE, property_t::type_t::size, init_args);
+    add_property(JACKALOPE_AUDIO_EQ_PROPERTY_CHANNELS, property_t::type_t::size, init_args);
+    add_property(JACKALOPE_AUDIO_EQ_PROPERTY_BANDS, property_t::type_t::size, init_args);
+
+    filter_plugin_t::init();
+}
+
+void eq_node_t::activate()
+{
+    assert_lockable_owner();
+
+    for (auto i : { JACKALOPE_PROPERTY_PCM_SAMPLE_RATE, JACKALOPE_PROPERTY_PCM_BUFFER_SIZE }) {
+        set_undef_property(i);
+    }
+
+    auto channels_property = get_property(JACKALOPE_AUDIO_EQ_PROPERTY_CHANNELS);
+    auto bands_property = get_property(JACKALOPE_AUDIO_EQ_PROPERTY_BANDS);
+
+    if (! channels_property->is_defined()) {
+        channels_property->set(1);
+    }
+
+    if (! bands_property->is_defined()) {
+        bands_property->set(1);
+    }
+
+    auto num_channels = channels_property->get_size();
+    auto num_bands = bands_property->get_size();
+    sample_rate = get_property(JACKALOPE_PROPERTY_PCM_SAMPLE_RATE)->get_size();
+
+    if (num_channels == 0) {
+        throw_runtime_error("eq node must have at least 1 channel");
+    }
+
+    for(size_t i = 1; i <= num_bands; i++) {
+        auto prefix = to_string("config.band.", i, ".");
+        auto type_property = add_property(prefix + "type", property_t::type_t::string, init_args);
+
+        band_t band;
+        band.frequency = add_property(prefix + "frequency", property_t::type_t::real, init_args);
+        band.q = add_property(prefix + "q", property_t::type_t::real, init_args);
+        band.gain = add_property(prefix + "gain", property_t::type_t::real, init_args);
+
+        if (! type_property->is_defined()) {
+            type_property->set(JACKALOPE_AUDIO_EQ_DEFAULT_TYPE);
+        }
+
+        if (! band.frequency->is_defined()) {
+            band.frequency->set(JACKALOPE_AUDIO_EQ_DEFAULT_FREQUENCY);
+        }
+
+        if (! band.q->is_defined()) {
+            band.q->set(JACKALOPE_AUDIO_EQ_DEFAULT_Q);
+        }
+
+        if (! band.gain->is_defined()) {
+            band.gain->set(0);
+        }
+
+        band.type = type_property->get_string();
+        bands.push_back(band);
+    }
+
+    bank = new biquad_bank_t(num_channels, num_bands);
+    update_coefficients();
+
+    for(size_t i = 1; i <= num_channels; i++) {
+        add_sink(to_string("input ", i), JACKALOPE_TYPE_AUDIO);
+        add_source(to_string("output ", i), JACKALOPE_TYPE_AUDIO);
+    }
+
+    filter_plugin_t::activate();
+}
+
+void eq_node_t::update_coefficients()
+{
+    assert_lockable_owner();
+
+    for(size_t i = 0; i < bands.size(); i++) {
+        auto& band = bands[i];
+        auto frequency = band.frequency->get_real();
+        auto q = band.q->get_real();
+        auto gain = band.gain->get_real();
+
+        if (frequency == band.last_frequency && q == band.last_q && gain == band.last_gain) {
+            continue;
+        }
+
+        // a bad value only fails activation; once the node is running the
+        // band keeps the coefficients it had so the audio does not stop
+        try {
+            bank->set_band(i, make_biquad(band.type, sample_rate, frequency, q, gain));
+        } catch (const std::runtime_error& e) {
+            if (! activated_flag) {
+                throw;
+            }
+
+            object_log_error("band ", i + 1, " was not changed: ", e.what());
+        }
+
+        band.last_frequency = frequency;
+        band.last_q = q;
+        band.last_gain = gain;
+    }
+}
+
+void eq_node_t::execute()
+{
+    assert_lockable_owner();
+
+    update_coefficients();
+
+    auto num_channels = bank->num_channels;
+    auto num_frames = get_sink<audio_sink_t>(0)->get_buffer()->num_samples;
+
+    if (frames.size() < num_frames * num_channels) {
+        frames.resize(num_frames * num_channels);
+    }
+
+    for(size_t i = 0; i < num_channels; i++) {
+        auto input_buffer = get_sink<audio_sink_t>(i)->get_buffer();
+
+        if (input_buffer->num_samples != num_frames) {
+            throw_runtime_error("eq input buffer sizes did not match: ", input_buffer->num_samples, " != ", num_frames);
+        }
+
+        pcm_insert_interleave(input_buffer->get_pointer(), frames.data(), i, num_channels, num_frames);
+    }
+
+    bank->process(frames.data(), num_frames);
+
+    for(size_t i = 0; i < num_channels; i++) {
+        auto output_buffer = jackalope::make_shared<audio_buffer_t>(num_frames);
+        pcm_extract_interleave(frames.data(), output_buffer->get_pointer(), i, num_channels, num_frames);
+
+        get_sink<audio_sink_t>(i)->reset();
+        get_source<audio_source_t>(i)->notify_buffer(output_buffer);
+    }
+}
+
+} // namespace audio
+
+} //namespace jackalope
@@ -0,0 +1,98 @@
+// Jackalope Audio Engine
+// Copyright 2019 Tyler Riddle <kg7oem@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+
+#pragma once
+
+#include <jackalope/plugin.h>
+#include <jackalope/types.h>
+
+#define JACKALOPE_AUDIO_EQ_OBJECT_TYPE          "audio::eq"
+#define JACKALOPE_AUDIO_EQ_PROPERTY_CHANNELS    "config.channels"
+#define JACKALOPE_AUDIO_EQ_PROPERTY_BANDS       "config.bands"
+#define JACKALOPE_AUDIO_EQ_DEFAULT_TYPE         "peak"
+#define JACKALOPE_AUDIO_EQ_DEFAULT_FREQUENCY    1000
+#define JACKALOPE_AUDIO_EQ_DEFAULT_Q            0.707
+
+namespace jackalope {
+
+namespace audio {
+
+void eq_init();
+
+struct biquad_coefficients_t {
+    real_t b0 = 1;
+    real_t b1 = 0;
+    real_t b2 = 0;
+    real_t a1 = 0;
+    real_t a2 = 0;
+};
+
+// type is one of lowpass, highpass, bandpass, notch, peak, lowshelf
+// or highshelf
+biquad_coefficients_t make_biquad(const string_t& type_in, const size_t sample_rate_in, const real_t frequency_in, const real_t q_in, const real_t gain_in);
+
+// cascaded biquads for a group of channels; the filter state is stored
+// with the channels next to each other so every channel is run through
+// a band in one loop
+class biquad_bank_t : public base_t {
+
+protected:
+    pool_vector_t<biquad_coefficients_t> coefficients;
+    pool_vector_t<real_t> z1;
+    pool_vector_t<real_t> z2;
+
+public:
+    const size_t num_channels;
+    const size_t num_bands;
+
+    biquad_bank_t(const size_t num_channels_in, const size_t num_bands_in);
+    void set_band(const size_t band_in, const biquad_coefficients_t& coefficients_in);
+    // frames_in holds num_frames_in frames of interleaved channels
+    void process(real_t * frames_in, const size_t num_frames_in);
+};
+
+// properties for band N are config.band.N.type, config.band.N.frequency,
+// config.band.N.q and config.band.N.gain in dB; every channel uses the
+// same bands and the type is only read when the node is activated
+class eq_node_t : public filter_plugin_t {
+
+protected:
+    struct band_t {
+        string_t type;
+        shared_t<property_t> frequency;
+        shared_t<property_t> q;
+        shared_t<property_t> gain;
+        real_t last_frequency = -1;
+        real_t last_q = -1;
+        real_t last_gain = -1;
+    };
+
+    biquad_bank_t * bank = nullptr;
+    pool_vector_t<band_t> bands;
+    pool_vector_t<real_t> frames;
+    size_t sample_rate = 0;
+
+    void update_coefficients();
+
+public:
+    eq_node_t(const init_args_t init_args_in);
+    virtual ~eq_node_t();
+
+    virtual void init() override;
+    virtual void activate() override;
+    virtual void execute() override;
+};
+
+} // namespace audio
+
+} //namespace jackalope
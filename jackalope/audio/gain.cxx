@@ -48,19 +48,22 @@ void gain_node_t::activate()
 {
     assert_lockable_owner();
 
-    add_property("config.gain", property_t::type_t::real, init_args);
+    gain_property = add_property("config.gain", property_t::type_t::real, init_args);
+    sample_rate_property = get_property(JACKALOPE_PROPERTY_PCM_SAMPLE_RATE);
 
     add_source("output", "audio");
     add_sink("input", "audio");
 
     filter_plugin_t::activate();
+
+    set_undef_property(JACKALOPE_PROPERTY_PCM_SAMPLE_RATE);
 }
 
 void gain_node_t::execute()
 {
     assert_lockable_owner();
 
-    auto scale_by = pcm_db_scale_factor(get_property("config.gain")->get_real());
+    auto gain = gain_property->get_real();
     auto sink = get_sink<audio_sink_t>(0);
     auto source = get_source<audio_source_t>(0);
 
@@ -69,7 +72,20 @@ void gain_node_t::execute()
 
     auto output_buffer = make_shared<audio_buffer_t>(input_buffer->num_samples);
     pcm_copy(input_buffer->get_pointer(), output_buffer->get_pointer(), output_buffer->num_samples);
-    pcm_multiply(output_buffer->get_pointer(), scale_by, output_buffer->num_samples);
+
+    if (gain_property->ramp.is_steady(gain)) {
+        pcm_multiply(output_buffer->get_pointer(), pcm_db_scale_factor(gain), output_buffer->num_samples);
+    } else {
+        auto num_samples = output_buffer->num_samples;
+
+        if (gain_values.size() < num_samples) {
+            gain_values.resize(num_samples);
+        }
+
+        gain_property->ramp.fill(gain_values.data(), num_samples, sample_rate_property->get_size(), gain);
+        pcm_db_scale_factor(gain_values.data(), num_samples);
+        pcm_multiply(output_buffer->get_pointer(), gain_values.data(), num_samples);
+    }
 
     source->notify_buffer(output_buffer);
 }
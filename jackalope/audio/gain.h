@@ -26,6 +26,11 @@ void gain_init();
 
 class gain_node_t : public filter_plugin_t {
 
+protected:
+    shared_t<property_t> gain_property;
+    shared_t<property_t> sample_rate_property;
+    pool_vector_t<real_t> gain_values;
+
 public:
     gain_node_t(const init_args_t init_args_in);
 
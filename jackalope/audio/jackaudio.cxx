@@ -51,7 +51,7 @@ shared_t<source_t> jackaudio_node_t::add_source(const string_t& source_name_in,
 {
     assert_lockable_owner();
 
-    if (sinks_by_name.count(source_name_in) != 0) {
+    if (sinks_by_name.count(symbol_t(source_name_in)) != 0) {
         throw_runtime_error("jackaudio sources can not have same name as sinks: ", source_name_in);
     }
 
@@ -62,7 +62,7 @@ shared_t<sink_t> jackaudio_node_t::add_sink(const string_t& sink_name_in, const
 {
     assert_lockable_owner();
 
-    if (sources_by_name.count(sink_name_in) != 0) {
+    if (sources_by_name.count(symbol_t(sink_name_in)) != 0) {
         throw_runtime_error("jackaudio sinks can not have same name as sources: ", sink_name_in);
     }
 
@@ -118,11 +118,18 @@ void jackaudio_node_t::activate()
     }
 
     for(auto& i : sources) {
-        add_port(i->name, JACK_DEFAULT_AUDIO_TYPE, jackaudio::JackPortIsInput);
+        auto port_type = i->type == JACKALOPE_TYPE_MIDI ? JACK_DEFAULT_MIDI_TYPE : JACK_DEFAULT_AUDIO_TYPE;
+        add_port(i->name, port_type, jackaudio::JackPortIsInput);
     }
 
     for(auto& i : sinks) {
-        add_port(i->name, JACK_DEFAULT_AUDIO_TYPE, jackaudio::JackPortIsOutput);
+        // control sinks are property bindings handled by the plugin
+        if (i->type == JACKALOPE_TYPE_CONTROL) {
+            continue;
+        }
+
+        auto port_type = i->type == JACKALOPE_TYPE_MIDI ? JACK_DEFAULT_MIDI_TYPE : JACK_DEFAULT_AUDIO_TYPE;
+        add_port(i->name, port_type, jackaudio::JackPortIsOutput);
     }
 
     auto helper = [] (const jackaudio_nframes_t num_frames_in, void * user_data) -> int_t {
@@ -143,7 +150,7 @@ void jackaudio_node_t::activate()
 // runs in a thread managed by jack audio
 int_t jackaudio_node_t::handle_jack_process(const jackaudio_nframes_t nframes_in)
 {
-    object_log_info("jackaudio thread gave us control");
+    object_log_trace("jackaudio thread gave us control");
     auto lock = get_object_lock();
 
     if (! started_flag) {
@@ -159,7 +166,7 @@ int_t jackaudio_node_t::handle_jack_process(const jackaudio_nframes_t nframes_in
         return true;
     }
 
-    object_log_info("jackaudio thread is running; nframes_in: ", nframes_in);
+    object_log_trace("jackaudio thread is running; nframes_in: ", nframes_in);
 
     auto const buffer_size = get_property(JACKALOPE_PROPERTY_PCM_BUFFER_SIZE)->get_size();
 
@@ -168,6 +175,28 @@ int_t jackaudio_node_t::handle_jack_process(const jackaudio_nframes_t nframes_in
     }
 
     for (auto i : sources) {
+        if (i->type == JACKALOPE_TYPE_MIDI) {
+            auto source = dynamic_pointer_cast<midi_source_t>(i);
+            auto portbuffer = get_raw_port_buffer(source->name);
+            auto buffer = jackalope::make_shared<midi_buffer_t>(buffer_size);
+            auto num_events = jackaudio::jack_midi_get_event_count(portbuffer);
+
+            for(uint32_t j = 0; j < num_events; j++) {
+                jackaudio_midi_event_t event;
+
+                if (jackaudio::jack_midi_event_get(&event, portbuffer, j) != 0) {
+                    continue;
+                }
+
+                if (! buffer->add_event(event.time, event.buffer, event.size)) {
+                    object_log_trace("jackaudio dropped a MIDI event; size: ", event.size);
+                }
+            }
+
+            source->notify_buffer(buffer);
+            continue;
+        }
+
         auto source = dynamic_pointer_cast<audio_source_t>(i);
         auto portbuffer = get_port_buffer(source->name);
         auto buffer = jackalope::make_shared<audio_buffer_t>(buffer_size);
@@ -176,14 +205,31 @@ int_t jackaudio_node_t::handle_jack_process(const jackaudio_nframes_t nframes_in
         source->notify_buffer(buffer);
     }
 
-    object_log_info("jackaudio thread is waiting for sinks to become ready");
+    object_log_trace("jackaudio thread is waiting for sinks to become ready");
     driver_thread_cond.wait(lock, [&] { return stopped_flag || driver_thread_run_flag; });
-    object_log_info("jackaudio thread woke up");
+    object_log_trace("jackaudio thread woke up");
 
     driver_thread_run_flag = false;
     driver_thread_cond.notify_all();
 
     for(auto i : sinks) {
+        if (i->type == JACKALOPE_TYPE_CONTROL) {
+            continue;
+        } else if (i->type == JACKALOPE_TYPE_MIDI) {
+            auto sink = dynamic_pointer_cast<midi_sink_t>(i);
+            auto portbuffer = get_raw_port_buffer(sink->name);
+            auto buffer = sink->get_buffer();
+
+            sink->reset();
+            jackaudio::jack_midi_clear_buffer(portbuffer);
+
+            for(auto& event : *buffer) {
+                jackaudio::jack_midi_event_write(portbuffer, event.frame, event.data, event.size);
+            }
+
+            continue;
+        }
+
         auto sink = dynamic_pointer_cast<audio_sink_t>(i);
         auto portbuffer = get_port_buffer(sink->name);
         auto buffer = sink->get_buffer();
@@ -192,7 +238,7 @@ int_t jackaudio_node_t::handle_jack_process(const jackaudio_nframes_t nframes_in
         pcm_copy(buffer->get_pointer(), portbuffer, buffer_size);
     }
 
-    object_log_info("jackaudio thread is done running");
+    object_log_trace("jackaudio thread is done running");
 
     return false;
 }
@@ -245,7 +291,7 @@ jackaudio_port_t * jackaudio_node_t::add_port(const string_t& port_name_in, cons
     return jack_ports[port_name_in] = new_port;
 }
 
-real_t * jackaudio_node_t::get_port_buffer(const string_t& port_name_in)
+void * jackaudio_node_t::get_raw_port_buffer(const string_t& port_name_in)
 {
     assert_lockable_owner();
 
@@ -256,7 +302,12 @@ real_t * jackaudio_node_t::get_port_buffer(const string_t& port_name_in)
     auto buffer = jack_port_get_buffer(jack_ports[port_name_in], get_property(JACKALOPE_PROPERTY_PCM_BUFFER_SIZE)->get_size());
 
     assert(buffer != nullptr);
-    return static_cast<real_t *>(buffer);
+    return buffer;
+}
+
+real_t * jackaudio_node_t::get_port_buffer(const string_t& port_name_in)
+{
+    return static_cast<real_t *>(get_raw_port_buffer(port_name_in));
 }
 
 } // namespace audio
@@ -14,6 +14,7 @@
 #pragma once
 
 #include <jackalope/audio.h>
+#include <jackalope/midi.h>
 #include <jackalope/plugin.h>
 #include <jackalope/types.h>
 
@@ -28,12 +29,14 @@ namespace jackaudio {
 
 extern "C" {
 #include <jack/jack.h>
+#include <jack/midiport.h>
 }
 
 } // namespace jackaudio
 
 using jackaudio_client_t = jackaudio::jack_client_t;
 using jackaudio_flags_t = unsigned long;
+using jackaudio_midi_event_t = jackaudio::jack_midi_event_t;
 using jackaudio_nframes_t = jackaudio::jack_nframes_t;
 using jackaudio_options_t = jackaudio::jack_options_t;
 using jackaudio_port_t = jackaudio::jack_port_t;
@@ -56,6 +59,7 @@ public:
     virtual shared_t<source_t> add_source(const string_t& source_name_in, const string_t& type_in) override;
     virtual shared_t<sink_t> add_sink(const string_t& sink_name_in, const string_t& type_in) override;
     virtual jackaudio_port_t * add_port(const string_t& port_name_in, const char * port_type_in, const jackaudio_flags_t flags_in);
+    virtual void * get_raw_port_buffer(const string_t& port_name_in);
     virtual real_t * get_port_buffer(const string_t& port_name_in);
     virtual void init() override;
     virtual void activate() override;
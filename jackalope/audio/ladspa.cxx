@@ -161,6 +161,32 @@ void ladspa_node_t::init_instance()
             }
         }
     }
+
+    for(auto& i : init_args_find(JACKALOPE_PCM_LADSPA_ARG_MIDI, init_args)) {
+        auto parts = split_string(i.first, '.');
+
+        if (parts.size() != 3 || parts.at(1) != "cc") {
+            throw_runtime_error("invalid LADSPA MIDI argument: ", i.first);
+        }
+
+        auto cc_num = std::stoul(parts.at(2).c_str());
+        auto port_num = instance->get_port_num(i.second);
+        auto descriptor = instance->get_port_descriptor(port_num);
+
+        if (cc_num > 127) {
+            throw_runtime_error("MIDI controller number is out of range: ", cc_num);
+        }
+
+        if (! LADSPA_IS_PORT_CONTROL(descriptor) || ! LADSPA_IS_PORT_INPUT(descriptor)) {
+            throw_runtime_error("MIDI controllers can only be mapped to control input ports: ", i.second);
+        }
+
+        midi_cc_to_port[cc_num] = port_num;
+    }
+
+    if (midi_cc_to_port.size() > 0) {
+        add_sink(JACKALOPE_PCM_LADSPA_SINK_MIDI, JACKALOPE_TYPE_MIDI);
+    }
 }
 
 void ladspa_node_t::activate()
@@ -173,8 +199,9 @@ void ladspa_node_t::activate()
 
     filter_plugin_t::activate();
 
-    auto sample_rate_prop = get_property(JACKALOPE_PROPERTY_PCM_SAMPLE_RATE);
-    auto sample_rate = sample_rate_prop->get_size();
+    buffer_size_property = get_property(JACKALOPE_PROPERTY_PCM_BUFFER_SIZE);
+    sample_rate_property = get_property(JACKALOPE_PROPERTY_PCM_SAMPLE_RATE);
+    auto sample_rate = sample_rate_property->get_size();
 
     init_file();
     init_instance();
@@ -182,7 +209,13 @@ void ladspa_node_t::activate()
     instance->instantiate(sample_rate);
     instance->activate();
 
-    for(size_t port_num = 0; port_num < instance->get_num_ports(); port_num++) {
+    auto num_ports = instance->get_num_ports();
+    control_values.assign(num_ports, 0);
+    control_inputs.assign(num_ports, nullptr);
+    control_outputs.assign(num_ports, nullptr);
+    audio_pointers.assign(num_ports, nullptr);
+
+    for(size_t port_num = 0; port_num < num_ports; port_num++) {
         auto descriptor = instance->get_port_descriptor(port_num);
         auto port_name = instance->get_port_name(port_num);
 
@@ -195,16 +228,22 @@ void ladspa_node_t::activate()
                     property->set(instance->get_port_default(port_num));
                 }
 
-                instance->connect_port(port_num, &property->get_real());
+                control_inputs[port_num] = property;
+                control_values[port_num] = property->get_real();
+                property->ramp.reset(control_values[port_num]);
+                instance->connect_port(port_num, &control_values[port_num]);
             } else if (LADSPA_IS_PORT_OUTPUT(descriptor)) {
                 auto property_name = to_string("state.", port_name);
                 auto property = get_property(property_name);
 
                 property->set(0);
-                instance->connect_port(port_num, &property->get_real());
+                control_outputs[port_num] = property;
+                instance->connect_port(port_num, &control_values[port_num]);
             }
         }
     }
+
+    probe_latency();
 }
 
 void ladspa_node_t::execute()
@@ -214,7 +253,8 @@ void ladspa_node_t::execute()
     assert(started_flag);
     assert(! stopped_flag);
 
-    auto buffer_size = get_property(JACKALOPE_PROPERTY_PCM_BUFFER_SIZE)->get_size();
+    auto buffer_size = buffer_size_property->get_size();
+    auto sample_rate = sample_rate_property->get_size();
     pool_map_t<string_t, shared_t<audio_buffer_t>> source_buffers;
 
     for(size_t port_num = 0; port_num < instance->get_num_ports(); port_num++) {
@@ -226,16 +266,71 @@ void ladspa_node_t::execute()
             if(LADSPA_IS_PORT_INPUT(descriptor)) {
                 auto sink = get_sink<audio_sink_t>(port_name);
                 auto buffer = sink->get_buffer();
-                instance->connect_port(port_num, buffer->get_pointer());
+                audio_pointers[port_num] = buffer->get_pointer();
             } else if (LADSPA_IS_PORT_OUTPUT(descriptor)) {
                 auto buffer = jackalope::make_shared<audio_buffer_t>(buffer_size);
                 source_buffers[port_name] = buffer;
-                instance->connect_port(port_num, buffer->get_pointer());
+                audio_pointers[port_num] = buffer->get_pointer();
             }
         }
     }
 
-    instance->run(buffer_size);
+    // LADSPA control ports only change once per run() so ramps
+    // are applied per block
+    for(size_t port_num = 0; port_num < control_inputs.size(); port_num++) {
+        auto& property = control_inputs[port_num];
+
+        if (property != nullptr) {
+            control_values[port_num] = property->ramp.advance(buffer_size, sample_rate, property->get_real());
+        }
+    }
+
+    size_t done_samples = 0;
+
+    if (midi_cc_to_port.size() > 0) {
+        // MIDI controller changes are sample accurate: run() is split at
+        // each event so the new value takes effect on the right frame
+        auto midi_sink = get_sink<midi_sink_t>(JACKALOPE_PCM_LADSPA_SINK_MIDI);
+        auto midi_buffer = midi_sink->get_buffer();
+
+        for(auto& event : *midi_buffer) {
+            if (! event.is_control_change()) {
+                continue;
+            }
+
+            auto found = midi_cc_to_port.find(event.data[1]);
+
+            if (found == midi_cc_to_port.end()) {
+                continue;
+            }
+
+            auto port_num = found->second;
+
+            if (event.frame > done_samples) {
+                run_instance(done_samples, event.frame - done_samples);
+                done_samples = event.frame;
+            }
+
+            auto value = instance->scale_port_value(port_num, event.data[2] / 127.0, sample_rate);
+            auto& property = control_inputs[port_num];
+
+            control_values[port_num] = value;
+            property->set_real(value);
+            property->ramp.reset(value);
+        }
+
+        midi_sink->reset();
+    }
+
+    if (done_samples < buffer_size) {
+        run_instance(done_samples, buffer_size - done_samples);
+    }
+
+    for(size_t port_num = 0; port_num < control_outputs.size(); port_num++) {
+        if (control_outputs[port_num] != nullptr) {
+            control_outputs[port_num]->set_real(control_values[port_num]);
+        }
+    }
 
     for(size_t port_num = 0; port_num < instance->get_num_ports(); port_num++) {
         auto descriptor = instance->get_port_descriptor(port_num);
@@ -244,6 +339,7 @@ void ladspa_node_t::execute()
             auto port_name = instance->get_port_name(port_num);
 
             instance->connect_port(port_num, nullptr);
+            audio_pointers[port_num] = nullptr;
 
             if (LADSPA_IS_PORT_INPUT(descriptor)) {
                 auto sink = get_sink<audio_sink_t>(port_name);
@@ -257,6 +353,52 @@ void ladspa_node_t::execute()
     }
 }
 
+void ladspa_node_t::run_instance(const size_t offset_in, const size_t num_samples_in)
+{
+    assert_lockable_owner();
+
+    for(size_t port_num = 0; port_num < audio_pointers.size(); port_num++) {
+        if (audio_pointers[port_num] != nullptr) {
+            instance->connect_port(port_num, audio_pointers[port_num] + offset_in);
+        }
+    }
+
+    instance->run(num_samples_in);
+}
+
+// plugins only write their latency port from run() so a plugin that
+// has one is run on a block of silence to know the latency before the
+// graph starts
+void ladspa_node_t::probe_latency()
+{
+    assert_lockable_owner();
+
+    if (! has_property(JACKALOPE_PROPERTY_NODE_LATENCY)) {
+        return;
+    }
+
+    auto latency_property = get_property(JACKALOPE_PROPERTY_NODE_LATENCY);
+    auto buffer_size = buffer_size_property->get_size();
+    auto num_ports = instance->get_num_ports();
+    pool_vector_t<ladspa_data_t> silence(buffer_size * num_ports, 0);
+
+    for(size_t port_num = 0; port_num < num_ports; port_num++) {
+        if (LADSPA_IS_PORT_AUDIO(instance->get_port_descriptor(port_num))) {
+            instance->connect_port(port_num, silence.data() + port_num * buffer_size);
+        }
+    }
+
+    instance->run(buffer_size);
+
+    for(size_t port_num = 0; port_num < num_ports; port_num++) {
+        if (LADSPA_IS_PORT_AUDIO(instance->get_port_descriptor(port_num))) {
+            instance->connect_port(port_num, nullptr);
+        } else if (control_outputs[port_num] == latency_property) {
+            latency_property->set_real(control_values[port_num]);
+        }
+    }
+}
+
 ladspa_file_t::ladspa_file_t(const string_t& path_in)
 : path(path_in)
 {
@@ -413,6 +555,42 @@ ladspa_data_t ladspa_instance_t::get_port_default(const size_t port_num_in)
     throw_runtime_error("could not find hint for LADSPA port: ", port_num_in);
 }
 
+ladspa_data_t ladspa_instance_t::scale_port_value(const size_t port_num_in, const real_t position_in, const size_t sample_rate_in)
+{
+    if (port_num_in >= get_num_ports()) {
+        throw_runtime_error("port number was greater than LADSPA port count: ", port_num_in);
+    }
+
+    auto port_hints = descriptor->PortRangeHints[port_num_in];
+    auto hint_descriptor = port_hints.HintDescriptor;
+
+    if (LADSPA_IS_HINT_TOGGLED(hint_descriptor)) {
+        return position_in >= 0.5 ? 1 : 0;
+    }
+
+    ladspa_data_t lower = LADSPA_IS_HINT_BOUNDED_BELOW(hint_descriptor) ? port_hints.LowerBound : 0;
+    ladspa_data_t upper = LADSPA_IS_HINT_BOUNDED_ABOVE(hint_descriptor) ? port_hints.UpperBound : 1;
+
+    if (LADSPA_IS_HINT_SAMPLE_RATE(hint_descriptor)) {
+        lower *= sample_rate_in;
+        upper *= sample_rate_in;
+    }
+
+    ladspa_data_t value;
+
+    if (LADSPA_IS_HINT_LOGARITHMIC(hint_descriptor) && lower > 0 && upper > 0) {
+        value = std::exp(std::log(lower) * (1 - position_in) + std::log(upper) * position_in);
+    } else {
+        value = lower * (1 - position_in) + upper * position_in;
+    }
+
+    if (LADSPA_IS_HINT_INTEGER(hint_descriptor)) {
+        value = std::round(value);
+    }
+
+    return value;
+}
+
 void ladspa_instance_t::instantiate(const size_t sample_rate_in)
 {
     handle = descriptor->instantiate(descriptor, sample_rate_in);
@@ -14,6 +14,7 @@
 #pragma once
 
 #include <jackalope/audio.h>
+#include <jackalope/midi.h>
 #include <jackalope/plugin.h>
 #include <jackalope/types.h>
 
@@ -22,6 +23,10 @@
 #define JACKALOPE_AUDIO_LADSPA_OBJECT_TYPE "audio::ladspa"
 #define JACKALOPE_PCM_LADSPA_PROPERTY_ID "plugin.id"
 #define JACKALOPE_PCM_LADSPA_PROPERTY_FILE "plugin.file"
+// init args named midi.cc.<number> map a MIDI controller to the
+// named control input port
+#define JACKALOPE_PCM_LADSPA_ARG_MIDI "midi"
+#define JACKALOPE_PCM_LADSPA_SINK_MIDI "midi"
 
 namespace jackalope {
 
@@ -68,6 +73,7 @@ struct ladspa_instance_t : public base_t {
     const string_t get_port_name(const size_t port_num_in);
     size_t get_port_num(const string_t& port_name_in);
     ladspa_data_t get_port_default(const size_t port_num_in);
+    ladspa_data_t scale_port_value(const size_t port_num_in, const real_t position_in, const size_t sample_rate_in);
     void instantiate(const size_t sample_rate_in);
     void activate();
     void run(const size_t num_samples_in);
@@ -77,6 +83,17 @@ struct ladspa_instance_t : public base_t {
 struct ladspa_node_t : public filter_plugin_t {
     ladspa_file_t * file = nullptr;
     ladspa_instance_t * instance = nullptr;
+    // LADSPA reads control ports through a pointer while it runs so the
+    // values are copied between these and the properties around run()
+    pool_vector_t<ladspa_data_t> control_values;
+    pool_vector_t<shared_t<property_t>> control_inputs;
+    pool_vector_t<shared_t<property_t>> control_outputs;
+    // audio port buffers for the current block so run() can be
+    // split at MIDI event boundaries
+    pool_vector_t<ladspa_data_t *> audio_pointers;
+    pool_map_t<size_t, size_t> midi_cc_to_port;
+    shared_t<property_t> buffer_size_property;
+    shared_t<property_t> sample_rate_property;
 
     ladspa_node_t(const init_args_t init_args_in);
     virtual ~ladspa_node_t();
@@ -85,6 +102,8 @@ struct ladspa_node_t : public filter_plugin_t {
     virtual void init_instance();
     virtual void activate() override;
     virtual void execute() override;
+    virtual void run_instance(const size_t offset_in, const size_t num_samples_in);
+    virtual void probe_latency();
 };
 
 } // namespace pcm
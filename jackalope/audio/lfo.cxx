@@ -0,0 +1,94 @@
+// Jackalope Audio Engine
+// Copyright 2019 Tyler Riddle <kg7oem@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+
+
+#include <cmath>
+
+#include <jackalope/audio/lfo.h>
+#include <jackalope/pcm.h>
+
+namespace jackalope {
+
+namespace audio {
+
+static shared_t<lfo_node_t> lfo_node_constructor(NDEBUG_UNUSED const string_t& type_in, const init_args_t init_args_in)
+{
+    assert(type_in == JACKALOPE_AUDIO_LFO_OBJECT_TYPE);
+
+    return jackalope::make_shared<lfo_node_t>(init_args_in);
+}
+
+void lfo_init()
+{
+    add_object_constructor(JACKALOPE_AUDIO_LFO_OBJECT_TYPE, lfo_node_constructor);
+}
+
+lfo_node_t::lfo_node_t(const init_args_t init_args_in)
+: filter_plugin_t(init_args_in)
+{ }
+
+void lfo_node_t::init()
+{
+    assert_lockable_owner();
+
+    add_property(JACKALOPE_PROPERTY_PCM_BUFFER_SIZE, property_t::type_t::size, init_args);
+    add_property(JACKALOPE_PROPERTY_PCM_SAMPLE_RATE, property_t::type_t::size, init_args);
+
+    filter_plugin_t::init();
+}
+
+void lfo_node_t::activate()
+{
+    assert_lockable_owner();
+
+    rate_property = add_property(JACKALOPE_AUDIO_LFO_PROPERTY_RATE, property_t::type_t::real, init_args);
+    depth_property = add_property(JACKALOPE_AUDIO_LFO_PROPERTY_DEPTH, property_t::type_t::real, init_args);
+    center_property = add_property(JACKALOPE_AUDIO_LFO_PROPERTY_CENTER, property_t::type_t::real, init_args);
+    buffer_size_property = get_property(JACKALOPE_PROPERTY_PCM_BUFFER_SIZE);
+    sample_rate_property = get_property(JACKALOPE_PROPERTY_PCM_SAMPLE_RATE);
+
+    if (! rate_property->is_defined()) {
+        rate_property->set(JACKALOPE_AUDIO_LFO_DEFAULT_RATE);
+    }
+
+    for (auto i : { depth_property, center_property }) {
+        if (! i->is_defined()) {
+            i->set(0);
+        }
+    }
+
+    add_source("output", JACKALOPE_TYPE_CONTROL);
+
+    filter_plugin_t::activate();
+
+    for (auto i : { JACKALOPE_PROPERTY_PCM_SAMPLE_RATE, JACKALOPE_PROPERTY_PCM_BUFFER_SIZE }) {
+        set_undef_property(i);
+    }
+}
+
+void lfo_node_t::execute()
+{
+    assert_lockable_owner();
+
+    auto source = get_source<control_source_t>(0);
+    auto value = center_property->get_real() + depth_property->get_real() * std::sin(phase);
+    auto block_seconds = static_cast<real_t>(buffer_size_property->get_size()) / sample_rate_property->get_size();
+
+    phase = std::fmod(phase + 2 * M_PI * rate_property->get_real() * block_seconds, 2 * M_PI);
+
+    source->notify_value(value);
+}
+
+} // namespace audio
+
+} //namespace jackalope
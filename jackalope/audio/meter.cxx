@@ -0,0 +1,208 @@
+// Jackalope Audio Engine
+// Copyright 2019 Tyler Riddle <kg7oem@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+
+
+#include <cmath>
+
+#include <jackalope/audio.h>
+#include <jackalope/audio/meter.h>
+#include <jackalope/control.h>
+#include <jackalope/pcm.h>
+
+namespace jackalope {
+
+namespace audio {
+
+static shared_t<meter_node_t> meter_node_constructor(NDEBUG_UNUSED const string_t& type_in, const init_args_t init_args_in)
+{
+    assert(type_in == JACKALOPE_AUDIO_METER_OBJECT_TYPE);
+
+    return jackalope::make_shared<meter_node_t>(init_args_in);
+}
+
+void meter_init()
+{
+    add_object_constructor(JACKALOPE_AUDIO_METER_OBJECT_TYPE, meter_node_constructor);
+}
+
+meter_node_t::meter_node_t(const init_args_t init_args_in)
+: filter_plugin_t(init_args_in)
+{ }
+
+void meter_node_t::init()
+{
+    assert_lockable_owner();
+
+    add_property(JACKALOPE_PROPERTY_PCM_BUFFER_SIZE, property_t::type_t::size, init_args);
+    add_property(JACKALOPE_PROPERTY_PCM_SAMPLE_RATE, property_t::type_t::size, init_args);
+
+    updated_signal = add_signal(JACKALOPE_AUDIO_METER_SIGNAL_UPDATED);
+
+    filter_plugin_t::init();
+}
+
+void meter_node_t::activate()
+{
+    assert_lockable_owner();
+
+    auto bands_property = add_property(JACKALOPE_AUDIO_METER_PROPERTY_BANDS, property_t::type_t::size, init_args);
+
+    if (! bands_property->is_defined()) {
+        bands_property->set(0);
+    }
+
+    auto num_bands = bands_property->get_size();
+
+    if (num_bands > JACKALOPE_AUDIO_METER_MAX_BANDS) {
+        throw_runtime_error("meter can have at most ", JACKALOPE_AUDIO_METER_MAX_BANDS, " bands: ", num_bands);
+    }
+
+    add_source("output", JACKALOPE_TYPE_AUDIO);
+    add_source("peak", JACKALOPE_TYPE_CONTROL);
+    add_source("rms", JACKALOPE_TYPE_CONTROL);
+    add_sink("input", JACKALOPE_TYPE_AUDIO);
+
+    filter_plugin_t::activate();
+
+    for (auto i : { JACKALOPE_PROPERTY_PCM_SAMPLE_RATE, JACKALOPE_PROPERTY_PCM_BUFFER_SIZE }) {
+        set_undef_property(i);
+    }
+
+    if (num_bands > 0) {
+        init_spectrum(num_bands, get_property(JACKALOPE_PROPERTY_PCM_BUFFER_SIZE)->get_size());
+    }
+}
+
+void meter_node_t::init_spectrum(const size_t num_bands_in, const size_t buffer_size_in)
+{
+    assert_lockable_owner();
+
+    size_t fft_size = 2;
+
+    while(fft_size < buffer_size_in) {
+        fft_size *= 2;
+    }
+
+    fft = get_fft(fft_size);
+    fft_work.resize(fft_size);
+
+    // Hann window over the block so a steady tone does not smear
+    // across every band
+    window.resize(buffer_size_in);
+    window_gain = 0;
+
+    for(size_t i = 0; i < buffer_size_in; i++) {
+        window[i] = 0.5 - 0.5 * std::cos(2 * M_PI * i / buffer_size_in);
+        window_gain += window[i];
+    }
+
+    // bin 0 is DC and is left out; the band edges are spaced evenly
+    // in octaves from bin 1 up to the nyquist bin
+    auto num_bins = fft_size / 2;
+
+    band_edges.assign(num_bands_in + 1, 1);
+    band_edges[num_bands_in] = num_bins + 1;
+
+    for(size_t i = 1; i < num_bands_in; i++) {
+        auto edge = static_cast<size_t>(std::round(std::pow(num_bins, static_cast<real_t>(i) / num_bands_in)));
+        band_edges[i] = std::max(edge, band_edges[i - 1] + 1);
+    }
+
+    current.num_bands = num_bands_in;
+}
+
+void meter_node_t::measure_spectrum(const real_t * pcm_in, const size_t num_samples_in)
+{
+    assert_lockable_owner();
+
+    // a block longer than pcm.buffer_size is measured by its
+    // start only
+    auto num_samples = std::min(num_samples_in, window.size());
+
+    for(size_t i = 0; i < num_samples; i++) {
+        fft_work[i] = complex_t(pcm_in[i] * window[i], 0);
+    }
+
+    for(size_t i = num_samples; i < fft_work.size(); i++) {
+        fft_work[i] = 0;
+    }
+
+    fft->forward(fft_work.data());
+
+    auto scale = window_gain > 0 ? 2 / window_gain : 0;
+    auto num_bins = fft_work.size() / 2;
+
+    for(size_t band = 0; band < current.num_bands; band++) {
+        real_t magnitude = 0;
+        auto end = std::min(band_edges[band + 1], num_bins + 1);
+
+        for(size_t bin = band_edges[band]; bin < end; bin++) {
+            magnitude = std::max(magnitude, static_cast<real_t>(std::abs(fft_work[bin])));
+        }
+
+        current.bands[band] = magnitude * scale;
+    }
+}
+
+void meter_node_t::execute()
+{
+    assert_lockable_owner();
+
+    auto sink = get_sink<audio_sink_t>("input");
+    auto buffer = sink->get_buffer();
+    auto pcm = buffer->get_pointer();
+    auto num_samples = buffer->num_samples;
+
+    sink->reset();
+
+    current.blocks++;
+    current.peak = pcm_peak(pcm, num_samples);
+    current.rms = num_samples > 0 ? std::sqrt(pcm_dot(pcm, pcm, num_samples) / num_samples) : 0;
+
+    if (fft != nullptr) {
+        measure_spectrum(pcm, num_samples);
+    }
+
+    snapshot.store(current);
+    updated_signal->send();
+
+    // the buffer is not changed so it is passed along as is
+    get_source<audio_source_t>("output")->notify_buffer(buffer);
+    get_source<control_source_t>("peak")->notify_value(current.peak);
+    get_source<control_source_t>("rms")->notify_value(current.rms);
+}
+
+meter_snapshot_t meter_node_t::read_snapshot() const noexcept
+{
+    return snapshot.load();
+}
+
+pool_map_t<string_t, real_t> meter_node_t::get_stats()
+{
+    auto stats = filter_plugin_t::get_stats();
+    auto snapshot = read_snapshot();
+
+    stats.emplace("meter.blocks", snapshot.blocks);
+    stats.emplace("meter.peak", snapshot.peak);
+    stats.emplace("meter.rms", snapshot.rms);
+
+    for(size_t i = 0; i < snapshot.num_bands; i++) {
+        stats.emplace(to_string("meter.band.", i), snapshot.bands[i]);
+    }
+
+    return stats;
+}
+
+} // namespace audio
+
+} //namespace jackalope
@@ -0,0 +1,75 @@
+// Jackalope Audio Engine
+// Copyright 2019 Tyler Riddle <kg7oem@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+
+
+#pragma once
+
+#include <jackalope/fft.h>
+#include <jackalope/plugin.h>
+#include <jackalope/thread.h>
+#include <jackalope/types.h>
+
+#define JACKALOPE_AUDIO_METER_OBJECT_TYPE       "audio::meter"
+// number of spectrum bands; 0 turns the spectrum off
+#define JACKALOPE_AUDIO_METER_PROPERTY_BANDS    "config.bands"
+#define JACKALOPE_AUDIO_METER_MAX_BANDS         32
+// sent once per block after the snapshot is updated
+#define JACKALOPE_AUDIO_METER_SIGNAL_UPDATED    "meter.updated"
+
+namespace jackalope {
+
+namespace audio {
+
+void meter_init();
+
+struct meter_snapshot_t {
+    // counts processed blocks so readers can tell if the meter moved
+    size_t blocks = 0;
+    real_t peak = 0;
+    real_t rms = 0;
+    size_t num_bands = 0;
+    // peak magnitude of each band with the bands spaced evenly in
+    // octaves up to half the sample rate
+    real_t bands[JACKALOPE_AUDIO_METER_MAX_BANDS] = { 0 };
+};
+
+// passes audio through unchanged while measuring it; the snapshot can
+// be read from any thread with out touching the node
+class meter_node_t : public filter_plugin_t {
+
+protected:
+    seqlock_t<meter_snapshot_t> snapshot;
+    meter_snapshot_t current;
+    shared_t<fft_t> fft = nullptr;
+    pool_vector_t<complex_t> fft_work;
+    pool_vector_t<real_t> window;
+    real_t window_gain = 0;
+    pool_vector_t<size_t> band_edges;
+    shared_t<signal_t> updated_signal = nullptr;
+
+    virtual void init_spectrum(const size_t num_bands_in, const size_t buffer_size_in);
+    virtual void measure_spectrum(const real_t * pcm_in, const size_t num_samples_in);
+
+public:
+    meter_node_t(const init_args_t init_args_in);
+
+    virtual void init() override;
+    virtual void activate() override;
+    virtual void execute() override;
+    meter_snapshot_t read_snapshot() const noexcept;
+    virtual pool_map_t<string_t, real_t> get_stats() override;
+};
+
+} // namespace audio
+
+} //namespace jackalope
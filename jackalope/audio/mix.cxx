@@ -0,0 +1,112 @@
+// Jackalope Audio Engine
+// Copyright 2019 Tyler Riddle <kg7oem@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+
+#include <jackalope/audio.h>
+#include <jackalope/audio/mix.h>
+#include <jackalope/exception.h>
+
+namespace jackalope {
+
+namespace audio {
+
+static shared_t<mix_node_t> mix_node_constructor(NDEBUG_UNUSED const string_t& type_in, const init_args_t init_args_in)
+{
+    assert(type_in == JACKALOPE_AUDIO_MIX_OBJECT_TYPE);
+
+    return jackalope::make_shared<mix_node_t>(init_args_in);
+}
+
+void mix_init()
+{
+    add_object_constructor(JACKALOPE_AUDIO_MIX_OBJECT_TYPE, mix_node_constructor);
+}
+
+mix_node_t::mix_node_t(const init_args_t init_args_in)
+: filter_plugin_t(init_args_in)
+{ }
+
+void mix_node_t::init()
+{
+    assert_lockable_owner();
+
+    add_property(JACKALOPE_PROPERTY_PCM_BUFFER_SIZE, property_t::type_t::size, init_args);
+    add_property(JACKALOPE_PROPERTY_PCM_SAMPLE_RATE, property_t::type_t::size, init_args);
+    inputs_property = add_property(JACKALOPE_AUDIO_MIX_PROPERTY_INPUTS, property_t::type_t::size, init_args);
+
+    filter_plugin_t::init();
+}
+
+void mix_node_t::activate()
+{
+    assert_lockable_owner();
+
+    if (! inputs_property->is_defined()) {
+        inputs_property->set(JACKALOPE_AUDIO_MIX_DEFAULT_INPUTS);
+    }
+
+    auto num_inputs = inputs_property->get_size();
+
+    if (num_inputs == 0) {
+        throw_runtime_error("mix node must have at least 1 input");
+    }
+
+    for(size_t i = 1; i <= num_inputs; i++) {
+        auto gain_property = add_property(to_string("config.gain.", i), property_t::type_t::real, init_args);
+
+        if (! gain_property->is_defined()) {
+            gain_property->set(0);
+        }
+
+        gain_properties.push_back(gain_property);
+        add_sink(to_string("input ", i), JACKALOPE_TYPE_AUDIO);
+    }
+
+    add_source("output", JACKALOPE_TYPE_AUDIO);
+
+    filter_plugin_t::activate();
+}
+
+void mix_node_t::execute()
+{
+    assert_lockable_owner();
+
+    auto source = get_source<audio_source_t>(0);
+    shared_t<audio_buffer_t> output_buffer;
+
+    for(size_t i = 0; i < gain_properties.size(); i++) {
+        auto sink = get_sink<audio_sink_t>(i);
+        auto input_buffer = sink->get_buffer();
+        auto num_samples = input_buffer->num_samples;
+        auto gain = gain_properties[i]->get_real();
+
+        if (output_buffer == nullptr) {
+            output_buffer = jackalope::make_shared<audio_buffer_t>(num_samples);
+        } else if (output_buffer->num_samples != num_samples) {
+            throw_runtime_error("mix input buffer sizes did not match: ", output_buffer->num_samples, " != ", num_samples);
+        }
+
+        if (gain == 0) {
+            pcm_add(input_buffer->get_pointer(), output_buffer->get_pointer(), num_samples);
+        } else {
+            pcm_multiply_add(input_buffer->get_pointer(), output_buffer->get_pointer(), pcm_db_scale_factor(gain), num_samples);
+        }
+
+        sink->reset();
+    }
+
+    source->notify_buffer(output_buffer);
+}
+
+} // namespace audio
+
+} //namespace jackalope
@@ -124,9 +124,9 @@ void portaudio_node_t::activate()
 
 int portaudio_node_t::process(const void * input_buffer_in, void * output_buffer_in, size_t frames_per_buffer_in, const portaudio_stream_cb_time_info_t *, portaudio_stream_cb_flags status_flags_in)
 {
-    object_log_info("portaudio process() invoked");
+    object_log_trace("portaudio process() invoked");
     auto lock = get_object_lock();
-    object_log_info("portaudio process() got object lock");
+    object_log_trace("portaudio process() got object lock");
 
     auto output_buffer = static_cast<real_t *>(output_buffer_in);
     auto input_buffer = static_cast<const real_t *>(input_buffer_in);
@@ -191,9 +191,9 @@ int portaudio_node_t::process(const void * input_buffer_in, void * output_buffer
         source->notify_buffer(buffer);
     }
 
-    object_log_info("PortAudio thread is waiting to run");
+    object_log_trace("PortAudio thread is waiting to run");
     driver_thread_cond.wait(lock, [this] { return stopped_flag || driver_thread_run_flag; });
-    object_log_info("PortAudio is done waiting to run");
+    object_log_trace("PortAudio is done waiting to run");
 
     driver_thread_run_flag = false;
     driver_thread_cond.notify_all();
@@ -0,0 +1,194 @@
+// Jackalope Audio Engine
+// Copyright 2019 Tyler Riddle <kg7oem@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+
+#include <numeric>
+
+#include <jackalope/audio.h>
+#include <jackalope/audio/reblock.h>
+#include <jackalope/exception.h>
+
+namespace jackalope {
+
+namespace audio {
+
+static shared_t<reblock_node_t> reblock_node_constructor(NDEBUG_UNUSED const string_t& type_in, const init_args_t init_args_in)
+{
+    assert(type_in == JACKALOPE_AUDIO_REBLOCK_OBJECT_TYPE);
+
+    return jackalope::make_shared<reblock_node_t>(init_args_in);
+}
+
+void reblock_init()
+{
+    add_object_constructor(JACKALOPE_AUDIO_REBLOCK_OBJECT_TYPE, reblock_node_constructor);
+}
+
+reblock_node_t::reblock_node_t(const init_args_t init_args_in)
+: filter_plugin_t(init_args_in)
+{ }
+
+void reblock_node_t::init()
+{
+    assert_lockable_owner();
+
+    add_property(JACKALOPE_PROPERTY_PCM_BUFFER_SIZE, property_t::type_t::size, init_args);
+    add_property(JACKALOPE_PROPERTY_PCM_SAMPLE_RATE, property_t::type_t::size, init_args);
+    input_size_property = add_property(JACKALOPE_AUDIO_REBLOCK_PROPERTY_INPUT_SIZE, property_t::type_t::size, init_args);
+    latency_property = add_property(JACKALOPE_PROPERTY_NODE_LATENCY, property_t::type_t::real);
+
+    filter_plugin_t::init();
+}
+
+// the output has to wait for a full block so the worst case is the
+// output size less the part of each block that lines up with the input
+size_t reblock_node_t::get_latency(const size_t input_size_in)
+{
+    assert_lockable_owner();
+
+    if (input_size_in == 0) {
+        return 0;
+    }
+
+    return output_size - std::gcd(input_size_in, output_size);
+}
+
+void reblock_node_t::update_latency(const size_t input_size_in)
+{
+    assert_lockable_owner();
+
+    latency_property->set(get_latency(input_size_in));
+}
+
+void reblock_node_t::prime(const size_t input_size_in)
+{
+    assert_lockable_owner();
+
+    assert(! primed);
+
+    pool_vector_t<real_t> silence(get_latency(input_size_in), 0);
+    fifo.write(silence.data(), silence.size());
+
+    primed = true;
+}
+
+void reblock_node_t::activate()
+{
+    assert_lockable_owner();
+
+    for (auto i : { JACKALOPE_PROPERTY_PCM_SAMPLE_RATE, JACKALOPE_PROPERTY_PCM_BUFFER_SIZE }) {
+        set_undef_property(i);
+    }
+
+    output_size = get_property(JACKALOPE_PROPERTY_PCM_BUFFER_SIZE)->get_size();
+
+    if (output_size == 0) {
+        throw_runtime_error("reblock output size must not be 0");
+    }
+
+    if (input_size_property->is_defined()) {
+        update_latency(input_size_property->get_size());
+        fifo.reserve(get_latency(input_size_property->get_size()) + input_size_property->get_size() + output_size);
+    } else {
+        update_latency(0);
+    }
+
+    add_sink("input", JACKALOPE_TYPE_AUDIO);
+    add_source("output", JACKALOPE_TYPE_AUDIO);
+
+    filter_plugin_t::activate();
+}
+
+void reblock_node_t::start()
+{
+    assert_lockable_owner();
+
+    // with out the input size the silence is added when the first
+    // block shows up
+    if (input_size_property->is_defined()) {
+        prime(input_size_property->get_size());
+    }
+
+    filter_plugin_t::start();
+}
+
+// the queue never holds more than the latency and one block on either
+// side so a node upstream that makes audio on its own has to wait for
+// the output to be taken
+bool reblock_node_t::can_take_input()
+{
+    assert_lockable_owner();
+
+    auto sink = _get_sink(0);
+
+    if (! sink->has_links() || ! sink->is_ready()) {
+        return false;
+    }
+
+    if (! primed) {
+        return true;
+    }
+
+    return fifo.size() <= get_latency(input_size_property->get_size()) + output_size;
+}
+
+bool reblock_node_t::can_send_output()
+{
+    assert_lockable_owner();
+
+    auto source = _get_source(0);
+
+    return fifo.size() >= output_size && source->has_links() && source->is_available();
+}
+
+bool reblock_node_t::should_execute()
+{
+    assert_lockable_owner();
+
+    return can_take_input() || can_send_output();
+}
+
+void reblock_node_t::execute()
+{
+    assert_lockable_owner();
+
+    if (can_take_input()) {
+        auto sink = get_sink<audio_sink_t>(0);
+        auto input_buffer = sink->get_buffer();
+        auto input_size = input_buffer->num_samples;
+
+        if (! input_size_property->is_defined() || input_size_property->get_size() != input_size) {
+            input_size_property->set(input_size);
+            update_latency(input_size);
+        }
+
+        if (! primed) {
+            prime(input_size);
+        }
+
+        fifo.write(input_buffer->get_pointer(), input_size);
+        sink->reset();
+    }
+
+    if (! can_send_output()) {
+        return;
+    }
+
+    auto output_buffer = jackalope::make_shared<audio_buffer_t>(output_size);
+    fifo.read(output_buffer->get_pointer(), output_size);
+
+    get_source<audio_source_t>(0)->notify_buffer(output_buffer);
+}
+
+} // namespace audio
+
+} //namespace jackalope
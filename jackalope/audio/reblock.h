@@ -0,0 +1,66 @@
+// Jackalope Audio Engine
+// Copyright 2019 Tyler Riddle <kg7oem@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+
+#pragma once
+
+#include <jackalope/pcm.h>
+#include <jackalope/plugin.h>
+#include <jackalope/types.h>
+
+#define JACKALOPE_AUDIO_REBLOCK_OBJECT_TYPE         "audio::reblock"
+#define JACKALOPE_AUDIO_REBLOCK_PROPERTY_INPUT_SIZE "config.input_size"
+
+namespace jackalope {
+
+namespace audio {
+
+void reblock_init();
+
+// queues the sink "input" and sends it to the source "output" in
+// blocks of pcm.buffer_size samples; config.input_size is the size of
+// the blocks that arrive and lets the latency be known before the
+// first block
+//
+// input is taken as soon as it arrives and output is sent as soon as a
+// block is queued so a driver on either side is never kept waiting;
+// the queue starts with the latency in silence so the first input
+// block is enough to send the first output block and input is held
+// back once the queue has a full output block more than the latency
+class reblock_node_t : public filter_plugin_t {
+
+protected:
+    pcm_ring_t<real_t> fifo;
+    shared_t<property_t> input_size_property;
+    shared_t<property_t> latency_property;
+    size_t output_size = 0;
+    bool primed = false;
+
+    size_t get_latency(const size_t input_size_in);
+    void update_latency(const size_t input_size_in);
+    void prime(const size_t input_size_in);
+    bool can_take_input();
+    bool can_send_output();
+    virtual bool should_execute() override;
+
+public:
+    reblock_node_t(const init_args_t init_args_in);
+
+    virtual void init() override;
+    virtual void activate() override;
+    virtual void start() override;
+    virtual void execute() override;
+};
+
+} // namespace audio
+
+} //namespace jackalope
@@ -0,0 +1,262 @@
+// Jackalope Audio Engine
+// Copyright 2019 Tyler Riddle <kg7oem@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+
+#include <cmath>
+#include <numeric>
+
+#include <jackalope/audio.h>
+#include <jackalope/audio/resample.h>
+#include <jackalope/exception.h>
+
+namespace jackalope {
+
+namespace audio {
+
+static shared_t<resample_node_t> resample_node_constructor(NDEBUG_UNUSED const string_t& type_in, const init_args_t init_args_in)
+{
+    assert(type_in == JACKALOPE_AUDIO_RESAMPLE_OBJECT_TYPE);
+
+    return jackalope::make_shared<resample_node_t>(init_args_in);
+}
+
+void resample_init()
+{
+    add_object_constructor(JACKALOPE_AUDIO_RESAMPLE_OBJECT_TYPE, resample_node_constructor);
+}
+
+size_t resample_quality_taps(const string_t& quality_in)
+{
+    if (quality_in == JACKALOPE_AUDIO_RESAMPLE_QUALITY_LOW) {
+        return 8;
+    } else if (quality_in == JACKALOPE_AUDIO_RESAMPLE_QUALITY_MEDIUM) {
+        return 16;
+    } else if (quality_in == JACKALOPE_AUDIO_RESAMPLE_QUALITY_HIGH) {
+        return 32;
+    }
+
+    throw_runtime_error("unknown resample quality: ", quality_in);
+}
+
+static double sinc(const double x_in)
+{
+    if (x_in == 0) {
+        return 1;
+    }
+
+    return std::sin(M_PI * x_in) / (M_PI * x_in);
+}
+
+resampler_t::resampler_t(const size_t input_rate_in, const size_t output_rate_in, const size_t taps_per_phase_in)
+: input_rate(input_rate_in), output_rate(output_rate_in)
+{
+    if (input_rate == 0 || output_rate == 0) {
+        throw_runtime_error("resample rates must not be 0");
+    }
+
+    auto divisor = std::gcd(input_rate, output_rate);
+    up = output_rate / divisor;
+    down = input_rate / divisor;
+    num_taps = taps_per_phase_in;
+
+    if (up > JACKALOPE_AUDIO_RESAMPLE_MAX_PHASES) {
+        throw_runtime_error("resample ratio needs too many phases: ", input_rate, " -> ", output_rate);
+    }
+
+    // windowed sinc low pass at the upsampled rate with the cutoff just
+    // under the lower of the two nyquist frequencies
+    auto length = up * num_taps;
+    auto cutoff = 0.5 * 0.95 / std::max(up, down);
+    auto center = (length - 1) / 2.0;
+    pool_vector_t<double> prototype(length);
+
+    for(size_t i = 0; i < length; i++) {
+        auto window = 0.42 - 0.5 * std::cos(2 * M_PI * i / (length - 1)) + 0.08 * std::cos(4 * M_PI * i / (length - 1));
+        prototype[i] = 2 * cutoff * sinc(2 * cutoff * (i - center)) * window;
+    }
+
+    // each phase is stored reversed so it can be applied with a dot
+    // product against the history in order, and normalized to unity
+    // gain so there is no ripple between phases
+    table.resize(length);
+
+    for(size_t p = 0; p < up; p++) {
+        double sum = 0;
+
+        for(size_t k = 0; k < num_taps; k++) {
+            sum += prototype[p + k * up];
+        }
+
+        for(size_t k = 0; k < num_taps; k++) {
+            table[p * num_taps + (num_taps - 1 - k)] = prototype[p + k * up] / sum;
+        }
+    }
+
+    history.assign(num_taps - 1, 0);
+    position = num_taps - 1;
+}
+
+size_t resampler_t::get_num_taps()
+{
+    return num_taps;
+}
+
+void resampler_t::process(const real_t * input_in, const size_t num_samples_in, pcm_ring_t<real_t>& output_in)
+{
+    history.insert(history.end(), input_in, input_in + num_samples_in);
+    scratch.clear();
+
+    while(position < history.size()) {
+        auto first = history.data() + position + 1 - num_taps;
+        scratch.push_back(pcm_dot(table.data() + phase * num_taps, first, num_taps));
+
+        phase += down;
+        position += phase / up;
+        phase %= up;
+    }
+
+    // keep only the samples the next output still needs
+    auto consumed = position + 1 - num_taps;
+    history.erase(history.begin(), history.begin() + consumed);
+    position -= consumed;
+
+    output_in.write(scratch.data(), scratch.size());
+}
+
+resample_node_t::resample_node_t(const init_args_t init_args_in)
+: filter_plugin_t(init_args_in)
+{ }
+
+resample_node_t::~resample_node_t()
+{
+    if (resampler != nullptr) {
+        delete resampler;
+        resampler = nullptr;
+    }
+}
+
+void resample_node_t::init()
+{
+    assert_lockable_owner();
+
+    buffer_size_property = add_property(JACKALOPE_PROPERTY_PCM_BUFFER_SIZE, property_t::type_t::size, init_args);
+    add_property(JACKALOPE_PROPERTY_PCM_SAMPLE_RATE, property_t::type_t::size, init_args);
+    add_property(JACKALOPE_AUDIO_RESAMPLE_PROPERTY_INPUT_RATE, property_t::type_t::size, init_args);
+    add_property(JACKALOPE_AUDIO_RESAMPLE_PROPERTY_OUTPUT_RATE, property_t::type_t::size, init_args);
+    add_property(JACKALOPE_AUDIO_RESAMPLE_PROPERTY_QUALITY, property_t::type_t::string, init_args);
+    add_property(JACKALOPE_PROPERTY_NODE_LATENCY, property_t::type_t::real);
+
+    filter_plugin_t::init();
+}
+
+void resample_node_t::activate()
+{
+    assert_lockable_owner();
+
+    for (auto i : { JACKALOPE_PROPERTY_PCM_SAMPLE_RATE, JACKALOPE_PROPERTY_PCM_BUFFER_SIZE }) {
+        set_undef_property(i);
+    }
+
+    auto input_rate_property = get_property(JACKALOPE_AUDIO_RESAMPLE_PROPERTY_INPUT_RATE);
+    auto output_rate_property = get_property(JACKALOPE_AUDIO_RESAMPLE_PROPERTY_OUTPUT_RATE);
+    auto quality_property = get_property(JACKALOPE_AUDIO_RESAMPLE_PROPERTY_QUALITY);
+
+    if (! input_rate_property->is_defined()) {
+        throw_runtime_error("resample node requires ", JACKALOPE_AUDIO_RESAMPLE_PROPERTY_INPUT_RATE);
+    }
+
+    if (! output_rate_property->is_defined()) {
+        output_rate_property->set(get_property(JACKALOPE_PROPERTY_PCM_SAMPLE_RATE)->get());
+    }
+
+    if (! quality_property->is_defined()) {
+        quality_property->set(JACKALOPE_AUDIO_RESAMPLE_QUALITY_MEDIUM);
+    }
+
+    auto taps = resample_quality_taps(quality_property->get_string());
+    resampler = new resampler_t(input_rate_property->get_size(), output_rate_property->get_size(), taps);
+
+    auto buffer_size = buffer_size_property->get_size();
+    get_property(JACKALOPE_PROPERTY_NODE_LATENCY)->set(buffer_size);
+
+    // the silence, the block waiting to be sent and what one input
+    // block of the same length converts to
+    auto ratio = static_cast<double>(resampler->output_rate) / resampler->input_rate;
+    output_fifo.reserve(2 * buffer_size + std::ceil(buffer_size * ratio) + 1);
+
+    add_sink("input", JACKALOPE_TYPE_AUDIO);
+    add_source("output", JACKALOPE_TYPE_AUDIO);
+
+    filter_plugin_t::activate();
+}
+
+void resample_node_t::start()
+{
+    assert_lockable_owner();
+
+    pool_vector_t<real_t> silence(buffer_size_property->get_size(), 0);
+    output_fifo.clear();
+    output_fifo.write(silence.data(), silence.size());
+
+    filter_plugin_t::start();
+}
+
+bool resample_node_t::can_take_input()
+{
+    assert_lockable_owner();
+
+    auto sink = _get_sink(0);
+
+    return sink->has_links() && sink->is_ready() && output_fifo.size() <= 2 * buffer_size_property->get_size();
+}
+
+bool resample_node_t::can_send_output()
+{
+    assert_lockable_owner();
+
+    auto source = _get_source(0);
+
+    return output_fifo.size() >= buffer_size_property->get_size() && source->has_links() && source->is_available();
+}
+
+bool resample_node_t::should_execute()
+{
+    assert_lockable_owner();
+
+    return can_take_input() || can_send_output();
+}
+
+void resample_node_t::execute()
+{
+    assert_lockable_owner();
+
+    if (can_take_input()) {
+        auto sink = get_sink<audio_sink_t>(0);
+        auto input_buffer = sink->get_buffer();
+        resampler->process(input_buffer->get_pointer(), input_buffer->num_samples, output_fifo);
+        sink->reset();
+    }
+
+    if (! can_send_output()) {
+        return;
+    }
+
+    auto buffer_size = buffer_size_property->get_size();
+    auto output_buffer = jackalope::make_shared<audio_buffer_t>(buffer_size);
+    output_fifo.read(output_buffer->get_pointer(), buffer_size);
+
+    get_source<audio_source_t>(0)->notify_buffer(output_buffer);
+}
+
+} // namespace audio
+
+} //namespace jackalope
@@ -0,0 +1,93 @@
+// Jackalope Audio Engine
+// Copyright 2019 Tyler Riddle <kg7oem@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+
+#pragma once
+
+#include <jackalope/pcm.h>
+#include <jackalope/plugin.h>
+#include <jackalope/types.h>
+
+#define JACKALOPE_AUDIO_RESAMPLE_OBJECT_TYPE            "audio::resample"
+#define JACKALOPE_AUDIO_RESAMPLE_PROPERTY_INPUT_RATE    "config.input_rate"
+#define JACKALOPE_AUDIO_RESAMPLE_PROPERTY_OUTPUT_RATE   "config.output_rate"
+#define JACKALOPE_AUDIO_RESAMPLE_PROPERTY_QUALITY       "config.quality"
+#define JACKALOPE_AUDIO_RESAMPLE_QUALITY_LOW            "low"
+#define JACKALOPE_AUDIO_RESAMPLE_QUALITY_MEDIUM         "medium"
+#define JACKALOPE_AUDIO_RESAMPLE_QUALITY_HIGH           "high"
+#define JACKALOPE_AUDIO_RESAMPLE_MAX_PHASES             4096
+
+namespace jackalope {
+
+namespace audio {
+
+void resample_init();
+
+// rational ratio polyphase FIR sample rate converter; the filter for
+// every phase is computed once when the converter is made
+class resampler_t : public base_t {
+
+protected:
+    size_t up = 0;
+    size_t down = 0;
+    size_t num_taps = 0;
+    size_t phase = 0;
+    size_t position = 0;
+    pool_vector_t<real_t> table;
+    pool_vector_t<real_t> history;
+    // reused for every block so the audio path only allocates while
+    // the block size is growing
+    pool_vector_t<real_t> scratch;
+
+public:
+    const size_t input_rate;
+    const size_t output_rate;
+
+    resampler_t(const size_t input_rate_in, const size_t output_rate_in, const size_t taps_per_phase_in);
+    size_t get_num_taps();
+    // appends the converted samples to output_in
+    void process(const real_t * input_in, const size_t num_samples_in, pcm_ring_t<real_t>& output_in);
+};
+
+size_t resample_quality_taps(const string_t& quality_in);
+
+// converts the sink "input" at config.input_rate to the source "output"
+// at config.output_rate which defaults to pcm.sample_rate
+//
+// an input block does not always convert to a whole output block so
+// the output starts one block of silence ahead; input is taken as soon
+// as it arrives and output is sent whenever a block is queued but input
+// is held back once a block more than the silence is queued
+class resample_node_t : public filter_plugin_t {
+
+protected:
+    resampler_t * resampler = nullptr;
+    shared_t<property_t> buffer_size_property;
+    pcm_ring_t<real_t> output_fifo;
+
+    bool can_take_input();
+    bool can_send_output();
+    virtual bool should_execute() override;
+
+public:
+    resample_node_t(const init_args_t init_args_in);
+    virtual ~resample_node_t();
+
+    virtual void init() override;
+    virtual void activate() override;
+    virtual void start() override;
+    virtual void execute() override;
+};
+
+} // namespace audio
+
+} //namespace jackalope
@@ -125,7 +125,7 @@ void sndfile_node_t::activate()
 
     io_thread = new thread_t(std::bind(&sndfile_node_t::be_io_thread, this));
     set_thread_priority(*io_thread, thread_priority_t::normal);
-    object_log_info("waiting for IO thread to make buffers available");
+    object_log_trace("waiting for IO thread to make buffers available");
     wait_work_available();
 }
 
@@ -214,11 +214,11 @@ void sndfile_node_t::wait_work_available()
 {
     assert_lockable_owner();
 
-    object_log_info("waiting for work from sndfile io thread");
+    object_log_trace("waiting for work from sndfile io thread");
     // FIXME this seems awful
     thread_work_cond.wait(object_mutex, [this] { return stopped_flag || thread_work.size() > 0; });
     assert_lockable_owner();
-    object_log_info("done waiting for sndfile io thread");
+    object_log_trace("done waiting for sndfile io thread");
 }
 
 void sndfile_node_t::be_io_thread()
@@ -242,9 +242,9 @@ void sndfile_node_t::be_io_thread()
                 throw_runtime_error("read_ahead_bytes(", read_ahead_bytes, ") must be evenly divisible by buffer_size_butes(", buffer_size_bytes, ")");
             }
 
-            object_log_info("waiting for sndfile io thread to have work to do");
+            object_log_trace("waiting for sndfile io thread to have work to do");
             thread_work_cond.wait(lock, [&] { return stopped_flag || thread_work.size() < min_thread_work_size_buffers; });
-            object_log_info("sndfile io thread woke up");
+            object_log_trace("sndfile io thread woke up");
 
             if (stopped_flag) {
                 object_log_info("sndfile io node is exiting because the node is stopped");
@@ -257,7 +257,7 @@ void sndfile_node_t::be_io_thread()
         object_log_info("read_ahead: ", read_ahead_bytes, " bytes; read_size: ", read_size_bytes, " bytes; min_thread_work_size: ", min_thread_work_size_buffers, " samples");
         assert(source_file != nullptr);
         size_t frames_read = sndfile::sf_readf_float(source_file, buffer->get_pointer(), read_size_samples);
-        object_log_info("sndfile io thread frames read: ", frames_read);
+        object_log_trace("sndfile io thread frames read: ", frames_read);
 
         if (frames_read == 0) {
             object_log_info("sndfile got EOF");
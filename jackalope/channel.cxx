@@ -26,7 +26,7 @@ static sink_library_t * sink_library = new sink_library_t();
 const string_t link_available_message_t::message_name = JACKALOPE_MESSAGE_OBJECT_LINK_AVAILABLE;
 
 link_available_message_t::link_available_message_t(shared_t<link_t> link_in)
-: message_t(JACKALOPE_MESSAGE_OBJECT_LINK_AVAILABLE, link_in)
+: message_t(&message_name, link_in)
 {
     assert(link_in != nullptr);
 }
@@ -34,7 +34,7 @@ link_available_message_t::link_available_message_t(shared_t<link_t> link_in)
 const string_t link_ready_message_t::message_name = JACKALOPE_MESSAGE_OBJECT_LINK_READY;
 
 link_ready_message_t::link_ready_message_t(shared_t<link_t> link_in)
-: message_t(JACKALOPE_MESSAGE_OBJECT_LINK_READY, link_in)
+: message_t(&message_name, link_in)
 {
     assert(link_in != nullptr);
 }
@@ -42,7 +42,7 @@ link_ready_message_t::link_ready_message_t(shared_t<link_t> link_in)
 const string_t sink_ready_message_t::message_name = JACKALOPE_MESSAGE_OBJECT_SINK_READY;
 
 sink_ready_message_t::sink_ready_message_t(shared_t<sink_t> sink_in)
-: message_t(JACKALOPE_MESSAGE_OBJECT_SINK_READY, sink_in)
+: message_t(&message_name, sink_in)
 {
     assert(sink_in != nullptr);
 }
@@ -50,7 +50,7 @@ sink_ready_message_t::sink_ready_message_t(shared_t<sink_t> sink_in)
 const string_t source_available_message_t::message_name = JACKALOPE_MESSAGE_OBJECT_SOURCE_AVAILABLE;
 
 source_available_message_t::source_available_message_t(shared_t<source_t> source_in)
-: message_t(JACKALOPE_MESSAGE_OBJECT_SOURCE_AVAILABLE, source_in)
+: message_t(&message_name, source_in)
 {
     assert(source_in != nullptr);
 }
@@ -80,6 +80,26 @@ string_t link_t::description()
     return to_string(source->get_parent()->id, ":", source->name, " -> ", sink->get_parent()->id, ":", sink->name);
 }
 
+bool link_t::supports_delay()
+{
+    return false;
+}
+
+void link_t::set_delay(const size_t delay_in)
+{
+    if (delay_in != 0) {
+        throw_runtime_error("link does not support delay: ", description());
+    }
+}
+
+size_t link_t::get_delay()
+{
+    return 0;
+}
+
+void link_t::transfer(shared_t<link_t>)
+{ }
+
 channel_t::channel_t(const string_t name_in, const string_t& type_in, shared_t<object_t> parent_in)
 : parent(parent_in), name(name_in), type(type_in)
 {
@@ -95,6 +115,13 @@ void channel_t::_add_link(shared_t<link_t> link_in)
     links.push_back(link_in);
 }
 
+void channel_t::_remove_link(shared_t<link_t> link_in)
+{
+    assert_lockable_owner();
+
+    links.remove(link_in);
+}
+
 void channel_t::_start()
 {
     assert_lockable_owner();
@@ -124,6 +151,18 @@ shared_t<object_t> channel_t::get_parent()
     return parent.lock();
 }
 
+pool_list_t<shared_t<link_t>> channel_t::get_links()
+{
+    auto lock = get_object_lock();
+    return links;
+}
+
+bool channel_t::has_links()
+{
+    auto lock = get_object_lock();
+    return links.size() > 0;
+}
+
 void source_t::_start()
 {
     assert_lockable_owner();
@@ -140,6 +179,33 @@ void source_t::link(shared_t<sink_t> sink_in)
     sink_in->add_link(new_link);
 }
 
+// a buffer still held by the link is dropped with it and the ends
+// are told to check their state again so the blocks keep flowing; a
+// link that is being moved should transfer() its buffer first
+void source_t::unlink(shared_t<sink_t> sink_in)
+{
+    auto lock = get_object_lock();
+    shared_t<link_t> found = nullptr;
+
+    for(auto i : links) {
+        if (i->get_to() == sink_in) {
+            found = i;
+            break;
+        }
+    }
+
+    if (found == nullptr) {
+        throw_runtime_error("source is not linked to sink: ", name, " -> ", sink_in->name);
+    }
+
+    _remove_link(found);
+    sink_in->remove_link(found);
+
+    if (started && _is_available()) {
+        get_parent()->send_message<source_available_message_t>(shared_obj());
+    }
+}
+
 bool source_t::is_available()
 {
     auto lock = get_object_lock();
@@ -192,6 +258,17 @@ void sink_t::add_link(shared_t<link_t> link_in)
     _add_link(link_in);
 }
 
+void sink_t::remove_link(shared_t<link_t> link_in)
+{
+    auto lock = get_object_lock();
+
+    _remove_link(link_in);
+
+    if (started && _is_ready()) {
+        get_parent()->send_message<sink_ready_message_t>(shared_obj());
+    }
+}
+
 void sink_t::_start()
 {
     assert_lockable_owner();
@@ -80,6 +80,14 @@ public:
     virtual bool is_available() = 0;
     virtual bool is_ready() = 0;
     virtual string_t description();
+    // links that can delay what passes through them are used by the
+    // graph to line up paths with different latency
+    virtual bool supports_delay();
+    virtual void set_delay(const size_t delay_in);
+    virtual size_t get_delay();
+    // moves a block the link is holding onto a new link from the same
+    // kind of channel so the block is not lost when a link is replaced
+    virtual void transfer(shared_t<link_t> link_in);
 };
 
 struct channel_t : public base_t, protected lockable_t {
@@ -90,6 +98,7 @@ protected:
     bool started = false;
 
     virtual void _add_link(shared_t<link_t> link_in);
+    virtual void _remove_link(shared_t<link_t> link_in);
 
 public:
     const string_t name;
@@ -98,6 +107,8 @@ public:
     channel_t(const string_t name_in, const string_t& type_in, shared_t<object_t> parent_in);
     virtual ~channel_t() = default;
     shared_t<object_t> get_parent();
+    pool_list_t<shared_t<link_t>> get_links();
+    bool has_links();
 
     virtual void _start();
     virtual void start();
@@ -115,6 +126,7 @@ public:
     virtual ~source_t() = default;
     virtual void _start() override;
     virtual void link(shared_t<sink_t> sink_in);
+    virtual void unlink(shared_t<sink_t> sink_in);
     virtual shared_t<link_t> make_link(shared_t<source_t> from_in, shared_t<sink_t> to_in) = 0;
     virtual bool is_available();
     virtual bool _is_available() = 0;
@@ -134,6 +146,7 @@ public:
     static shared_t<sink_t> make(const string_t& name_in, const string_t& type_in, shared_t<object_t> parent_in);
     virtual ~sink_t() = default;
     virtual void add_link(shared_t<link_t> link_in);
+    virtual void remove_link(shared_t<link_t> link_in);
     virtual void _start() override;
     virtual void reset();
     virtual bool is_ready();
@@ -0,0 +1,237 @@
+// Jackalope Audio Engine
+// Copyright 2019 Tyler Riddle <kg7oem@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+
+
+#include <cassert>
+
+#include <jackalope/control.h>
+#include <jackalope/object.h>
+
+namespace jackalope {
+
+static shared_t<control_source_t> control_source_constructor(const string_t& name_in, shared_t<object_t> parent_in)
+{
+    return jackalope::make_shared<control_source_t>(name_in, parent_in);
+}
+
+static shared_t<control_sink_t> control_sink_constructor(const string_t& name_in, shared_t<object_t> parent_in)
+{
+    return jackalope::make_shared<control_sink_t>(name_in, parent_in);
+}
+
+void control_init()
+{
+    add_source_constructor(JACKALOPE_TYPE_CONTROL, control_source_constructor);
+    add_sink_constructor(JACKALOPE_TYPE_CONTROL, control_sink_constructor);
+}
+
+control_link_t::control_link_t(shared_t<source_t> source_in, shared_t<sink_t> sink_in)
+: link_t(source_in, sink_in)
+{
+    assert(source_in->type == sink_in->type);
+}
+
+bool control_link_t::is_available()
+{
+    auto lock = get_object_lock();
+
+    return ! ready_flag;
+}
+
+bool control_link_t::is_ready()
+{
+    auto lock = get_object_lock();
+
+    return ready_flag;
+}
+
+void control_link_t::reset()
+{
+    auto source = guard_lockable({
+        assert(ready_flag);
+
+        ready_flag = false;
+
+        return get_from();
+    });
+
+    source->link_available(shared_obj());
+}
+
+void control_link_t::set_value(const real_t value_in)
+{
+    auto lock = get_object_lock();
+
+    assert(! ready_flag);
+
+    value = value_in;
+    ready_flag = true;
+}
+
+real_t control_link_t::get_value()
+{
+    auto lock = get_object_lock();
+
+    assert(ready_flag);
+
+    return value;
+}
+
+void control_link_t::transfer(shared_t<link_t> link_in)
+{
+    auto target = dynamic_pointer_cast<control_link_t>(link_in);
+
+    assert(target != nullptr);
+
+    auto moved = guard_lockable({
+        if (! ready_flag) {
+            return false;
+        }
+
+        auto available = target->is_available();
+
+        if (available) {
+            target->set_value(value);
+        }
+
+        ready_flag = false;
+
+        return available;
+    });
+
+    if (moved) {
+        link_in->get_to()->get_parent()->send_message<link_ready_message_t>(link_in);
+    }
+}
+
+control_source_t::control_source_t(const string_t name_in, shared_t<object_t> parent_in)
+: source_t(name_in, JACKALOPE_TYPE_CONTROL, parent_in)
+{ }
+
+bool control_source_t::_is_available()
+{
+    assert_lockable_owner();
+
+    for(auto& i : links) {
+        if (! i->is_available()) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+shared_t <link_t> control_source_t::make_link(shared_t<source_t> from_in, shared_t<sink_t> to_in)
+{
+    return jackalope::make_shared<control_link_t>(from_in, to_in);
+}
+
+void control_source_t::link(shared_t<sink_t> sink_in)
+{
+    if (sink_in->type != JACKALOPE_TYPE_CONTROL) {
+        throw_runtime_error("Incompatible types during link: ", type, " -> ", sink_in->type);
+    }
+
+    source_t::link(sink_in);
+}
+
+void control_source_t::notify_value(const real_t value_in)
+{
+    auto lock = get_object_lock();
+    _notify_value(value_in);
+}
+
+void control_source_t::_notify_value(const real_t value_in)
+{
+    assert_lockable_owner();
+
+    for(auto i : links) {
+        i->shared_obj<control_link_t>()->set_value(value_in);
+    }
+
+    source_t::_notify();
+}
+
+control_sink_t::control_sink_t(const string_t name_in, shared_t<object_t> parent_in)
+: sink_t(name_in, JACKALOPE_TYPE_CONTROL, parent_in)
+{ }
+
+real_t control_sink_t::get_value()
+{
+    auto lock = get_object_lock();
+
+    return _get_value();
+}
+
+real_t control_sink_t::_get_value()
+{
+    assert_lockable_owner();
+
+    real_t value = 0;
+
+    for(auto& i : links) {
+        value += i->shared_obj<control_link_t>()->get_value();
+    }
+
+    return value;
+}
+
+bool control_sink_t::_is_ready()
+{
+    assert_lockable_owner();
+
+    for(auto& i : links) {
+        if (! i->is_ready()) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool control_sink_t::_is_available()
+{
+    assert_lockable_owner();
+
+    for(auto& i : links) {
+        if (i->is_ready()) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void control_sink_t::_reset()
+{
+    assert_lockable_owner();
+
+    for(auto i : links) {
+        auto link = i->shared_obj<control_link_t>();
+
+        if (! link->is_available()) {
+            link->reset();
+        }
+    }
+}
+
+void control_sink_t::_forward(shared_t<source_t> source_in)
+{
+    assert_lockable_owner();
+
+    auto value = _get_value();
+
+    source_in->shared_obj<control_source_t>()->notify_value(value);
+}
+
+} //namespace jackalope
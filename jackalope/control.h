@@ -0,0 +1,71 @@
+// Jackalope Audio Engine
+// Copyright 2019 Tyler Riddle <kg7oem@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+
+
+#pragma once
+
+#include <jackalope/channel.h>
+#include <jackalope/thread.h>
+#include <jackalope/types.h>
+
+#define JACKALOPE_TYPE_CONTROL "control"
+// init args named bind.<sink name> add a control sink that sets the
+// named property once per block
+#define JACKALOPE_CONTROL_ARG_BIND "bind"
+
+namespace jackalope {
+
+void control_init();
+
+class control_link_t : public link_t, lockable_t {
+
+protected:
+    bool ready_flag = false;
+    real_t value = 0;
+
+public:
+    control_link_t(shared_t<source_t> from_in, shared_t<sink_t> to_in);
+    virtual void reset();
+    virtual bool is_available() override;
+    virtual bool is_ready() override;
+    virtual real_t get_value();
+    virtual void set_value(const real_t value_in);
+    virtual void transfer(shared_t<link_t> link_in) override;
+};
+
+class control_source_t : public source_t {
+
+public:
+    control_source_t(const string_t name_in, shared_t<object_t> parent_in);
+    virtual bool _is_available() override;
+    virtual shared_t<link_t> make_link(shared_t<source_t> from_in, shared_t<sink_t> to_in) override;
+    virtual void link(shared_t<sink_t> sink_in) override;
+    virtual void notify_value(const real_t value_in);
+    virtual void _notify_value(const real_t value_in);
+};
+
+class control_sink_t : public sink_t {
+
+public:
+    control_sink_t(const string_t name_in, shared_t<object_t> parent_in);
+    // values from every link are summed so several modulators can
+    // drive one property
+    virtual real_t get_value();
+    virtual real_t _get_value();
+    virtual bool _is_available() override;
+    virtual bool _is_ready() override;
+    virtual void _reset() override;
+    virtual void _forward(shared_t<source_t> source_in) override;
+};
+
+} //namespace jackalope
@@ -11,13 +11,34 @@
 // MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
 // GNU Lesser General Public License for more details.
 
+#include <chrono>
+
 #include <jackalope/exception.h>
 #include <jackalope/dbus.h>
+#include <jackalope/object.h>
 
 namespace jackalope {
 
 static thread_t * dispatcher_thread = nullptr;
+static thread_t * notify_thread = nullptr;
 static DBus::BusDispatcher * global_dispatcher = nullptr;
+static std::mutex objects_mutex;
+static pool_list_t<object_dbus_t *> objects;
+
+// every watched property is compared to the last value sent so many
+// changes inside of one interval go out as a single signal
+static void notify_loop()
+{
+    while(1) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(JACKALOPE_DBUS_NOTIFY_INTERVAL_MS));
+
+        std::unique_lock<std::mutex> lock(objects_mutex);
+
+        for(auto i : objects) {
+            i->notify_changes();
+        }
+    }
+}
 
 void dbus_init() {
     assert(global_dispatcher == nullptr);
@@ -30,6 +51,19 @@ void dbus_init() {
     connection.request_name(JACKALOPE_DBUS_NAME_DEFAULT);
 
     dispatcher_thread = new thread_t([] { global_dispatcher->enter(); });
+    notify_thread = new thread_t(notify_loop);
+}
+
+void dbus_add_object(object_dbus_t * object_in)
+{
+    std::unique_lock<std::mutex> lock(objects_mutex);
+    objects.push_back(object_in);
+}
+
+void dbus_remove_object(object_dbus_t * object_in)
+{
+    std::unique_lock<std::mutex> lock(objects_mutex);
+    objects.remove(object_in);
 }
 
 DBus::Connection& dbus_get_connection()
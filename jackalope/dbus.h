@@ -21,10 +21,16 @@
 
 #define JACKALOPE_DBUS_NAME_PREFIX     "x-kg7oem.jackalope.server"
 #define JACKALOPE_DBUS_NAME_DEFAULT    "x-kg7oem.jackalope.server.default"
+// watched properties are checked for changes this often
+#define JACKALOPE_DBUS_NOTIFY_INTERVAL_MS  50
 
 namespace jackalope {
 
+struct object_dbus_t;
+
 void dbus_init();
 DBus::Connection& dbus_get_connection();
+void dbus_add_object(object_dbus_t * object_in);
+void dbus_remove_object(object_dbus_t * object_in);
 
 } //namespace jackalope
@@ -0,0 +1,128 @@
+// Jackalope Audio Engine
+// Copyright 2019 Tyler Riddle <kg7oem@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+
+#include <cmath>
+
+#include <jackalope/exception.h>
+#include <jackalope/fft.h>
+#include <jackalope/thread.h>
+
+namespace jackalope {
+
+static mutex_t fft_cache_mutex;
+static pool_map_t<size_t, weak_t<fft_t>> fft_cache;
+
+shared_t<fft_t> get_fft(const size_t size_in)
+{
+    lock_t lock(fft_cache_mutex);
+
+    auto found = fft_cache.find(size_in);
+
+    if (found != fft_cache.end()) {
+        auto fft = found->second.lock();
+
+        if (fft != nullptr) {
+            return fft;
+        }
+    }
+
+    auto fft = jackalope::make_shared<fft_t>(size_in);
+    fft_cache[size_in] = fft;
+
+    return fft;
+}
+
+fft_t::fft_t(const size_t size_in)
+: size(size_in)
+{
+    if (size < 2 || (size & (size - 1)) != 0) {
+        throw_runtime_error("FFT size must be a power of 2: ", size);
+    }
+
+    size_t bits = 0;
+    while ((1UL << bits) < size) {
+        bits++;
+    }
+
+    bit_reverse.resize(size);
+    for(size_t i = 0; i < size; i++) {
+        size_t reversed = 0;
+
+        for(size_t j = 0; j < bits; j++) {
+            if (i & (1UL << j)) {
+                reversed |= 1UL << (bits - 1 - j);
+            }
+        }
+
+        bit_reverse[i] = reversed;
+    }
+
+    twiddles.resize(size / 2);
+    for(size_t i = 0; i < size / 2; i++) {
+        auto angle = -2 * M_PI * i / size;
+        twiddles[i] = complex_t(std::cos(angle), std::sin(angle));
+    }
+}
+
+void fft_t::transform(complex_t * data_in, const bool inverse_in)
+{
+    for(size_t i = 0; i < size; i++) {
+        auto j = bit_reverse[i];
+
+        if (i < j) {
+            std::swap(data_in[i], data_in[j]);
+        }
+    }
+
+    for(size_t length = 2; length <= size; length <<= 1) {
+        auto half = length / 2;
+        auto stride = size / length;
+
+        for(size_t start = 0; start < size; start += length) {
+            for(size_t k = 0; k < half; k++) {
+                auto twiddle = twiddles[k * stride];
+
+                if (inverse_in) {
+                    twiddle = std::conj(twiddle);
+                }
+
+                auto& even = data_in[start + k];
+                auto& odd = data_in[start + k + half];
+
+                auto odd_real = odd.real() * twiddle.real() - odd.imag() * twiddle.imag();
+                auto odd_imag = odd.real() * twiddle.imag() + odd.imag() * twiddle.real();
+
+                odd = complex_t(even.real() - odd_real, even.imag() - odd_imag);
+                even = complex_t(even.real() + odd_real, even.imag() + odd_imag);
+            }
+        }
+    }
+}
+
+void fft_t::forward(complex_t * data_in)
+{
+    transform(data_in, false);
+}
+
+void fft_t::inverse(complex_t * data_in)
+{
+    transform(data_in, true);
+
+    real_t scale = 1.0 / size;
+
+    for(size_t i = 0; i < size; i++) {
+        data_in[i] *= scale;
+    }
+}
+
+} // namespace jackalope
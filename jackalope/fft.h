@@ -0,0 +1,57 @@
+// Jackalope Audio Engine
+// Copyright 2019 Tyler Riddle <kg7oem@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+
+#pragma once
+
+#include <jackalope/types.h>
+
+namespace jackalope {
+
+// radix 2 complex FFT; the twiddle factors and bit reversal order
+// are computed when the plan is made
+class fft_t : public base_t {
+
+protected:
+    pool_vector_t<complex_t> twiddles;
+    pool_vector_t<size_t> bit_reverse;
+
+    void transform(complex_t * data_in, const bool inverse_in);
+
+public:
+    const size_t size;
+
+    fft_t(const size_t size_in);
+    void forward(complex_t * data_in);
+    // the result is scaled by 1 / size
+    void inverse(complex_t * data_in);
+};
+
+// plans are shared by everything using the same size
+shared_t<fft_t> get_fft(const size_t size_in);
+
+// dest_in += left_in * right_in
+inline void spectrum_multiply_add(const complex_t * left_in, const complex_t * right_in, complex_t * dest_in, const size_t num_bins_in)
+{
+    // written out so the compiler does not need to handle the
+    // inf/nan cases that std::complex multiply has to
+    auto left = reinterpret_cast<const real_t *>(left_in);
+    auto right = reinterpret_cast<const real_t *>(right_in);
+    auto dest = reinterpret_cast<real_t *>(dest_in);
+
+    for(size_t i = 0; i < num_bins_in * 2; i += 2) {
+        dest[i] += left[i] * right[i] - left[i + 1] * right[i + 1];
+        dest[i + 1] += left[i] * right[i + 1] + left[i + 1] * right[i];
+    }
+}
+
+} // namespace jackalope
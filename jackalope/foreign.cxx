@@ -12,9 +12,15 @@
 // GNU Lesser General Public License for more details.
 
 
+#include <cerrno>
+#include <cmath>
+#include <cstring>
+#include <fcntl.h>
 #include <iostream>
+#include <unistd.h>
 
 #include <jackalope/async.h>
+#include <jackalope/audio/meter.h>
 #include <jackalope/foreign.h>
 #include <jackalope/jackalope.h>
 
@@ -28,6 +34,10 @@ jackalope_sink_t::jackalope_sink_t(shared_t<jackalope::sink_t> wrapped_in)
 : jackalope_wrapper_t(wrapped_in)
 { }
 
+jackalope_property_t::jackalope_property_t(shared_t<jackalope::property_t> wrapped_in)
+: jackalope_wrapper_t(wrapped_in)
+{ }
+
 jackalope_object_t::jackalope_object_t(jackalope::shared_t<jackalope::object_t> wrapped_in)
 : jackalope_wrapper_t(wrapped_in)
 {
@@ -51,6 +61,33 @@ string_t jackalope_object_t::peek(const string_t& property_name_in)
     });
 }
 
+double jackalope_object_t::peek_number(const string_t& property_name_in)
+{
+    auto property = wrapped->get_property(property_name_in);
+
+    if (! property->is_defined()) {
+        return NAN;
+    }
+
+    return property->get_number();
+}
+
+void jackalope_object_t::poke_numbers(const pool_vector_t<std::pair<string_t, double>>& values_in)
+{
+    wait_job([&] {
+        auto lock = wrapped->get_object_lock();
+
+        for(auto& i : values_in) {
+            wrapped->poke(i.first, i.second);
+        }
+    });
+}
+
+jackalope_property_t jackalope_object_t::get_property(const string_t& property_name_in)
+{
+    return jackalope_property_t(wrapped->get_property(property_name_in));
+}
+
 void jackalope_object_t::poke(const string_t& property_name_in, const double value_in)
 {
     wait_job([&] {
@@ -67,6 +104,14 @@ void jackalope_object_t::poke(const string_t& property_name_in, const string_t&
     });
 }
 
+void jackalope_object_t::ramp(const string_t& property_name_in, const ramp_points_t& points_in)
+{
+    wait_job([&] {
+        auto lock = wrapped->get_object_lock();
+        wrapped->ramp(property_name_in, points_in);
+    });
+}
+
 void jackalope_object_t::start()
 {
     wait_job([&] {
@@ -104,6 +149,20 @@ jackalope_graph_t jackalope_graph_t::make(const jackalope::graph_t::prop_args_t&
     return jackalope_graph_t(new_graph);
 }
 
+jackalope_graph_t jackalope_graph_t::load(const string_t& path_in)
+{
+    auto file = graph_file_t::load(path_in);
+    auto graph = jackalope_graph_t(graph_t::make(file->graph_args));
+    auto wrapped_graph = dynamic_pointer_cast<jackalope::graph_t>(graph.wrapped);
+
+    graph.wait_job([&] {
+        auto lock = wrapped_graph->get_object_lock();
+        wrapped_graph->load(file);
+    });
+
+    return graph;
+}
+
 jackalope_graph_t::jackalope_graph_t(shared_t<graph_t> wrapped_in)
 : jackalope_object_t(wrapped_in)
 { }
@@ -164,6 +223,27 @@ jackalope_network_t jackalope_graph_t::make_network(const jackalope::init_args_t
     return jackalope_network_t(new_network);
 }
 
+void jackalope_graph_t::remove_node(const string_t& name_in)
+{
+    auto graph = dynamic_pointer_cast<jackalope::graph_t>(wrapped);
+
+    wait_job([&] {
+        auto lock = graph->get_object_lock();
+        graph->remove_node(name_in);
+    });
+}
+
+void jackalope_graph_t::replace_node(const string_t& name_in, jackalope_node_t& node_in)
+{
+    auto graph = dynamic_pointer_cast<jackalope::graph_t>(wrapped);
+    auto node = node_in.wrapped->shared_obj<jackalope::node_t>();
+
+    wait_job([&] {
+        auto lock = graph->get_object_lock();
+        graph->replace_node(name_in, node);
+    });
+}
+
 void jackalope_graph_t::run()
 {
     auto stopped_signal = wait_job<shared_t<signal_t>>([&] {
@@ -235,6 +315,18 @@ void jackalope_node_t::link(const jackalope::string_t& source_name_in, jackalope
     });
 }
 
+void jackalope_node_t::unlink(const jackalope::string_t& source_name_in, jackalope_object_t& target_object_in, const jackalope::string_t& target_sink_name_in)
+{
+    wait_job([&] {
+        auto from_lock = wrapped->get_object_lock();
+        auto from = wrapped->shared_obj<jackalope::node_t>();
+        auto to = target_object_in.wrapped->shared_obj<jackalope::node_t>();
+        auto to_lock = to->get_object_lock();
+
+        from->unlink(source_name_in, to, target_sink_name_in);
+    });
+}
+
 void jackalope_node_t::forward(const jackalope::string_t& source_name_in, jackalope_node_t& target_node_in, const jackalope::string_t& target_name_in)
 {
     wait_job([&] {
@@ -297,6 +389,165 @@ void jackalope_network_t::add_property(const string_t& name_in, property_t::type
     });
 }
 
+jackalope_batch_t::jackalope_batch_t(jackalope_graph_t& graph_in)
+: graph(graph_in)
+{ }
+
+size_t jackalope_batch_t::make_node(const init_args_t& init_args_in)
+{
+    ops.push_back({ op_type_t::make_node, init_args_in, "", "", "", "" });
+    return ops.size() - 1;
+}
+
+size_t jackalope_batch_t::link(const string_t& from_in, const string_t& source_in, const string_t& to_in, const string_t& sink_in)
+{
+    ops.push_back({ op_type_t::link, { }, from_in, source_in, to_in, sink_in });
+    return ops.size() - 1;
+}
+
+size_t jackalope_batch_t::remove_node(const string_t& name_in)
+{
+    ops.push_back({ op_type_t::remove_node, { }, name_in, "", "", "" });
+    return ops.size() - 1;
+}
+
+size_t jackalope_batch_t::unlink(const string_t& from_in, const string_t& source_in, const string_t& to_in, const string_t& sink_in)
+{
+    ops.push_back({ op_type_t::unlink, { }, from_in, source_in, to_in, sink_in });
+    return ops.size() - 1;
+}
+
+size_t jackalope_batch_t::forward(const string_t& from_in, const string_t& source_in, const string_t& to_in, const string_t& sink_in)
+{
+    ops.push_back({ op_type_t::forward, { }, from_in, source_in, to_in, sink_in });
+    return ops.size() - 1;
+}
+
+size_t jackalope_batch_t::poke(const string_t& object_in, const string_t& property_in, const string_t& value_in)
+{
+    ops.push_back({ op_type_t::poke, { }, object_in, property_in, "", value_in });
+    return ops.size() - 1;
+}
+
+size_t jackalope_batch_t::subscribe(const string_t& from_in, const string_t& signal_in, const string_t& to_in, const string_t& slot_in)
+{
+    ops.push_back({ op_type_t::subscribe, { }, from_in, signal_in, to_in, slot_in });
+    return ops.size() - 1;
+}
+
+size_t jackalope_batch_t::submit()
+{
+    auto wrapped_graph = dynamic_pointer_cast<jackalope::graph_t>(graph.wrapped);
+
+    results.clear();
+    results.resize(ops.size());
+
+    return graph.wait_job<size_t>([&] {
+        auto graph_lock = wrapped_graph->get_object_lock();
+
+        auto get_object = [&](const string_t& name_in) -> shared_t<object_t> {
+            if (name_in == "") {
+                return wrapped_graph;
+            }
+
+            return wrapped_graph->get_node(name_in);
+        };
+
+        // the graph is already locked and the same object must
+        // not be locked twice
+        auto lock_object = [&](shared_t<object_t> object_in, shared_t<object_t> other_in) {
+            if (object_in == wrapped_graph || object_in == other_in) {
+                return lock_t();
+            }
+
+            return object_in->get_object_lock();
+        };
+
+        size_t num_done = 0;
+
+        for(; num_done < ops.size(); num_done++) {
+            auto& op = ops[num_done];
+            auto& result = results[num_done];
+
+            try {
+                switch(op.type) {
+                    case op_type_t::make_node: {
+                        result.node = wrapped_graph->make_node(op.init_args);
+                        break;
+                    }
+
+                    case op_type_t::remove_node: {
+                        wrapped_graph->remove_node(op.object);
+                        break;
+                    }
+
+                    case op_type_t::link:
+                    case op_type_t::unlink:
+                    case op_type_t::forward: {
+                        auto from = wrapped_graph->get_node(op.object);
+                        auto to = wrapped_graph->get_node(op.target);
+
+                        if (from == to) {
+                            throw_runtime_error("can not connect a node to itself: ", op.object);
+                        }
+
+                        auto from_lock = from->get_object_lock();
+                        auto to_lock = to->get_object_lock();
+
+                        if (op.type == op_type_t::link) {
+                            from->link(op.name, to, op.target_name);
+                        } else if (op.type == op_type_t::unlink) {
+                            from->unlink(op.name, to, op.target_name);
+                        } else {
+                            from->forward(op.name, to, op.target_name);
+                        }
+
+                        break;
+                    }
+
+                    case op_type_t::poke: {
+                        auto object = get_object(op.object);
+                        auto object_lock = lock_object(object, nullptr);
+                        object->poke(op.name, op.target_name);
+                        break;
+                    }
+
+                    case op_type_t::subscribe: {
+                        auto from = get_object(op.object);
+                        auto to = get_object(op.target);
+                        auto from_lock = lock_object(from, nullptr);
+                        auto to_lock = lock_object(to, from);
+                        from->subscribe(op.name, to, op.target_name);
+                        break;
+                    }
+                }
+            } catch (const std::exception& e) {
+                result.error = e.what();
+                break;
+            }
+
+            result.done = true;
+        }
+
+        return num_done;
+    });
+}
+
+const jackalope_batch_t::result_t& jackalope_batch_t::get_result(const size_t op_in)
+{
+    if (op_in >= results.size()) {
+        throw_runtime_error("batch operation has no result: ", op_in);
+    }
+
+    return results[op_in];
+}
+
+void jackalope_batch_t::clear()
+{
+    ops.clear();
+    results.clear();
+}
+
 extern "C" {
 
 void jackalope_init()
@@ -349,6 +600,172 @@ void jackalope_object_stop(jackalope_object_t * object_in)
     object_in->stop();
 }
 
+void jackalope_object_ramp(jackalope_object_t * object_in, const char * property_name_in, const float * values_in, const float * seconds_in, const unsigned int num_points_in)
+{
+    assert(object_in != nullptr);
+
+    ramp_points_t points;
+
+    for(size_t i = 0; i < num_points_in; i++) {
+        points.push_back({ values_in[i], seconds_in[i] });
+    }
+
+    object_in->ramp(property_name_in, points);
+}
+
+void jackalope_object_peek_numbers(jackalope_object_t * object_in, const char * names_in[], double * values_out, const unsigned int num_values_in)
+{
+    assert(object_in != nullptr);
+
+    for(unsigned int i = 0; i < num_values_in; i++) {
+        values_out[i] = object_in->peek_number(names_in[i]);
+    }
+}
+
+void jackalope_object_poke_numbers(jackalope_object_t * object_in, const char * names_in[], const double * values_in, const unsigned int num_values_in)
+{
+    assert(object_in != nullptr);
+
+    pool_vector_t<std::pair<string_t, double>> values;
+
+    for(unsigned int i = 0; i < num_values_in; i++) {
+        values.push_back({ names_in[i], values_in[i] });
+    }
+
+    object_in->poke_numbers(values);
+}
+
+struct jackalope_property_t * jackalope_object_get_property(jackalope_object_t * object_in, const char * name_in)
+{
+    assert(object_in != nullptr);
+
+    return new jackalope_property_t(object_in->get_property(name_in));
+}
+
+void jackalope_property_delete(jackalope_property_t * property_in)
+{
+    assert(property_in != nullptr);
+
+    delete property_in;
+}
+
+double jackalope_property_get_number(jackalope_property_t * property_in)
+{
+    assert(property_in != nullptr);
+
+    if (! property_in->wrapped->is_defined()) {
+        return NAN;
+    }
+
+    return property_in->wrapped->get_number();
+}
+
+void jackalope_property_set_number(jackalope_property_t * property_in, const double value_in)
+{
+    assert(property_in != nullptr);
+
+    property_in->wrapped->set(value_in);
+}
+
+jackalope_watch_t::jackalope_watch_t()
+{
+    int fds[2];
+
+    if (pipe(fds) != 0) {
+        throw_runtime_error("could not create a pipe for a signal watch: ", std::strerror(errno));
+    }
+
+    read_fd = fds[0];
+    write_fd = fds[1];
+
+    // neither end may block: signals are sent from the engine and
+    // reads drain what is there
+    fcntl(read_fd, F_SETFL, fcntl(read_fd, F_GETFL) | O_NONBLOCK);
+    fcntl(write_fd, F_SETFL, fcntl(write_fd, F_GETFL) | O_NONBLOCK);
+}
+
+jackalope_watch_t::~jackalope_watch_t()
+{
+    for(auto& i : entries) {
+        auto signal = i.signal.lock();
+
+        if (signal != nullptr) {
+            signal->remove_callback(i.callback_id);
+        }
+    }
+
+    close(read_fd);
+    close(write_fd);
+}
+
+void jackalope_watch_t::add(jackalope_object_t& object_in, const string_t& signal_name_in, const unsigned int id_in)
+{
+    auto signal = object_in.wait_job<shared_t<signal_t>>([&] {
+        auto lock = object_in.wrapped->get_object_lock();
+        return object_in.wrapped->get_signal(signal_name_in);
+    });
+
+    auto fd = write_fd;
+
+    // if the pipe is full the reader is behind and already has ids
+    // waiting so dropping this one only loses a duplicate wakeup
+    auto callback_id = signal->add_callback([fd, id_in] {
+        auto ignored = write(fd, &id_in, sizeof(id_in));
+        (void)ignored;
+    });
+
+    entries.push_back({ signal, callback_id });
+}
+
+jackalope::size_t jackalope_watch_t::read(unsigned int * ids_out, const jackalope::size_t max_ids_in)
+{
+    auto got = ::read(read_fd, ids_out, sizeof(unsigned int) * max_ids_in);
+
+    if (got < 0) {
+        if (errno == EAGAIN || errno == EWOULDBLOCK) {
+            return 0;
+        }
+
+        throw_runtime_error("could not read signal watch pipe: ", std::strerror(errno));
+    }
+
+    return got / sizeof(unsigned int);
+}
+
+struct jackalope_watch_t * jackalope_watch_make()
+{
+    return new jackalope_watch_t();
+}
+
+void jackalope_watch_delete(jackalope_watch_t * watch_in)
+{
+    assert(watch_in != nullptr);
+
+    delete watch_in;
+}
+
+int jackalope_watch_get_fd(jackalope_watch_t * watch_in)
+{
+    assert(watch_in != nullptr);
+
+    return watch_in->read_fd;
+}
+
+void jackalope_watch_add(jackalope_watch_t * watch_in, jackalope_object_t * object_in, const char * signal_in, const unsigned int id_in)
+{
+    assert(watch_in != nullptr);
+    assert(object_in != nullptr);
+
+    watch_in->add(*object_in, signal_in, id_in);
+}
+
+unsigned int jackalope_watch_read(jackalope_watch_t * watch_in, unsigned int * ids_out, const unsigned int max_ids_in)
+{
+    assert(watch_in != nullptr);
+
+    return watch_in->read(ids_out, max_ids_in);
+}
+
 struct jackalope_object_t * jackalope_graph_make(const char * init_args_in[])
 {
     auto init_args = init_args_from_strings(init_args_in);
@@ -356,6 +773,13 @@ struct jackalope_object_t * jackalope_graph_make(const char * init_args_in[])
     return new jackalope_graph_t(new_graph);
 }
 
+struct jackalope_object_t * jackalope_graph_load(const char * path_in)
+{
+    assert(path_in != nullptr);
+
+    return new jackalope_graph_t(jackalope_graph_t::load(path_in));
+}
+
 struct jackalope_object_t * jackalope_graph_make_node(jackalope_object_t * graph_in, const char * init_args_in[])
 {
     assert(graph_in != nullptr);
@@ -386,6 +810,23 @@ void jackalope_graph_run(struct jackalope_object_t * graph_in)
     graph->run();
 }
 
+void jackalope_graph_remove_node(struct jackalope_object_t * graph_in, const char * name_in)
+{
+    assert(graph_in != nullptr);
+
+    auto graph = dynamic_cast<jackalope_graph_t *>(graph_in);
+    graph->remove_node(name_in);
+}
+
+void jackalope_graph_replace_node(struct jackalope_object_t * graph_in, const char * name_in, struct jackalope_object_t * node_in)
+{
+    assert(graph_in != nullptr);
+    assert(node_in != nullptr);
+
+    auto graph = dynamic_cast<jackalope_graph_t *>(graph_in);
+    graph->replace_node(name_in, *static_cast<jackalope_node_t *>(node_in));
+}
+
 struct jackalope_object_t * jackalope_node_make(const char ** init_args_in)
 {
     auto init_args = init_args_from_strings(init_args_in);
@@ -430,4 +871,137 @@ void jackalope_node_link(jackalope_object_t * object_in, const char * source_in,
     static_cast<jackalope_node_t *>(object_in)->link(source_in, *target_object_in, sink_in);
 }
 
+void jackalope_node_unlink(jackalope_object_t * object_in, const char * source_in, jackalope_object_t * target_object_in, const char * sink_in)
+{
+    assert(object_in != nullptr);
+
+    static_cast<jackalope_node_t *>(object_in)->unlink(source_in, *target_object_in, sink_in);
+}
+
+static_assert(JACKALOPE_METER_READING_MAX_BANDS == JACKALOPE_AUDIO_METER_MAX_BANDS, "meter band limits must match");
+
+void jackalope_meter_read(jackalope_object_t * meters_in[], const unsigned int num_meters_in, jackalope_meter_reading_t * readings_out)
+{
+    assert(meters_in != nullptr);
+    assert(readings_out != nullptr);
+
+    for(unsigned int i = 0; i < num_meters_in; i++) {
+        auto meter = dynamic_pointer_cast<jackalope::audio::meter_node_t>(meters_in[i]->wrapped);
+        auto& reading = readings_out[i];
+
+        // exceptions can not go back through the C interface
+        if (meter == nullptr) {
+            std::memset(&reading, 0, sizeof(reading));
+            continue;
+        }
+
+        auto snapshot = meter->read_snapshot();
+
+        reading.blocks = snapshot.blocks;
+        reading.peak = snapshot.peak;
+        reading.rms = snapshot.rms;
+        reading.num_bands = snapshot.num_bands;
+
+        for(size_t j = 0; j < JACKALOPE_AUDIO_METER_MAX_BANDS; j++) {
+            reading.bands[j] = snapshot.bands[j];
+        }
+    }
+}
+
+struct jackalope_batch_t * jackalope_batch_make(jackalope_object_t * graph_in)
+{
+    assert(graph_in != nullptr);
+
+    return new jackalope_batch_t(*static_cast<jackalope_graph_t *>(graph_in));
+}
+
+void jackalope_batch_delete(jackalope_batch_t * batch_in)
+{
+    assert(batch_in != nullptr);
+
+    delete batch_in;
+}
+
+unsigned int jackalope_batch_make_node(jackalope_batch_t * batch_in, const char * init_args_in[])
+{
+    assert(batch_in != nullptr);
+
+    return batch_in->make_node(init_args_from_strings(init_args_in));
+}
+
+unsigned int jackalope_batch_link(jackalope_batch_t * batch_in, const char * from_in, const char * source_in, const char * to_in, const char * sink_in)
+{
+    assert(batch_in != nullptr);
+
+    return batch_in->link(from_in, source_in, to_in, sink_in);
+}
+
+unsigned int jackalope_batch_unlink(jackalope_batch_t * batch_in, const char * from_in, const char * source_in, const char * to_in, const char * sink_in)
+{
+    assert(batch_in != nullptr);
+
+    return batch_in->unlink(from_in, source_in, to_in, sink_in);
+}
+
+unsigned int jackalope_batch_remove_node(jackalope_batch_t * batch_in, const char * name_in)
+{
+    assert(batch_in != nullptr);
+
+    return batch_in->remove_node(name_in);
+}
+
+unsigned int jackalope_batch_forward(jackalope_batch_t * batch_in, const char * from_in, const char * source_in, const char * to_in, const char * sink_in)
+{
+    assert(batch_in != nullptr);
+
+    return batch_in->forward(from_in, source_in, to_in, sink_in);
+}
+
+unsigned int jackalope_batch_poke(jackalope_batch_t * batch_in, const char * object_in, const char * property_in, const char * value_in)
+{
+    assert(batch_in != nullptr);
+
+    return batch_in->poke(object_in, property_in, value_in);
+}
+
+unsigned int jackalope_batch_subscribe(jackalope_batch_t * batch_in, const char * from_in, const char * signal_in, const char * to_in, const char * slot_in)
+{
+    assert(batch_in != nullptr);
+
+    return batch_in->subscribe(from_in, signal_in, to_in, slot_in);
+}
+
+unsigned int jackalope_batch_submit(jackalope_batch_t * batch_in)
+{
+    assert(batch_in != nullptr);
+
+    return batch_in->submit();
+}
+
+const char * jackalope_batch_get_error(jackalope_batch_t * batch_in, const unsigned int op_in)
+{
+    assert(batch_in != nullptr);
+
+    auto& result = batch_in->get_result(op_in);
+
+    if (result.error == "") {
+        return nullptr;
+    }
+
+    return result.error.c_str();
+}
+
+struct jackalope_object_t * jackalope_batch_get_node(jackalope_batch_t * batch_in, const unsigned int op_in)
+{
+    assert(batch_in != nullptr);
+
+    auto& result = batch_in->get_result(op_in);
+
+    if (result.node == nullptr) {
+        return nullptr;
+    }
+
+    return new jackalope_node_t(result.node);
+}
+
 } // extern "C"
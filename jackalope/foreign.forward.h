@@ -5,9 +5,12 @@
 
 #pragma once
 
+struct jackalope_batch_t;
 struct jackalope_graph_t;
 struct jackalope_network_t;
 struct jackalope_node_t;
 struct jackalope_object_t;
+struct jackalope_property_t;
 struct jackalope_source_t;
 struct jackalope_sink_t;
+struct jackalope_watch_t;
@@ -27,17 +27,50 @@ extern "C" {
 
 struct dbus_objectAdaptee;
 
+#define JACKALOPE_METER_READING_MAX_BANDS 32
+
+struct jackalope_meter_reading_t {
+    unsigned long blocks;
+    float peak;
+    float rms;
+    unsigned int num_bands;
+    float bands[JACKALOPE_METER_READING_MAX_BANDS];
+};
+
 void jackalope_init();
 
 void jackalope_object_delete(struct jackalope_object_t * object_in);
 void jackalope_object_subscribe(struct jackalope_object_t * object_in, const char * signal_in, struct jackalope_object_t * target_object_in, const char * slot_in);
 void jackalope_object_start(struct jackalope_object_t * object_in);
 void jackalope_object_stop(struct jackalope_object_t * object_in);
+void jackalope_object_ramp(struct jackalope_object_t * object_in, const char * property_name_in, const float * values_in, const float * seconds_in, const unsigned int num_points_in);
+// numeric reads come straight from the property atomics with out a
+// job on the async engine; undefined properties read as NaN
+void jackalope_object_peek_numbers(struct jackalope_object_t * object_in, const char * names_in[], double * values_out, const unsigned int num_values_in);
+// every value is set in a single job on the async engine
+void jackalope_object_poke_numbers(struct jackalope_object_t * object_in, const char * names_in[], const double * values_in, const unsigned int num_values_in);
+struct jackalope_property_t * jackalope_object_get_property(struct jackalope_object_t * object_in, const char * name_in);
+
+void jackalope_property_delete(struct jackalope_property_t * property_in);
+double jackalope_property_get_number(struct jackalope_property_t * property_in);
+void jackalope_property_set_number(struct jackalope_property_t * property_in, const double value_in);
+
+// signals are reported as ids written to a pipe so a caller can wait
+// on the file descriptor and run its callbacks in its own thread
+struct jackalope_watch_t * jackalope_watch_make();
+void jackalope_watch_delete(struct jackalope_watch_t * watch_in);
+int jackalope_watch_get_fd(struct jackalope_watch_t * watch_in);
+void jackalope_watch_add(struct jackalope_watch_t * watch_in, struct jackalope_object_t * object_in, const char * signal_in, const unsigned int id_in);
+// does not block; returns the number of ids put into ids_out
+unsigned int jackalope_watch_read(struct jackalope_watch_t * watch_in, unsigned int * ids_out, const unsigned int max_ids_in);
 
 struct jackalope_object_t * jackalope_graph_make(const char * init_args_in[]);
+struct jackalope_object_t * jackalope_graph_load(const char * path_in);
 void jackalope_graph_add_node(struct jackalope_object_t * graph_in, struct jackalope_object_t * node_in);
 struct jackalope_object_t * jackalope_graph_make_node(struct jackalope_object_t * graph_in, const char * init_args_in[]);
 void jackalope_graph_run(struct jackalope_object_t * graph_in);
+void jackalope_graph_remove_node(struct jackalope_object_t * graph_in, const char * name_in);
+void jackalope_graph_replace_node(struct jackalope_object_t * graph_in, const char * name_in, struct jackalope_object_t * node_in);
 
 struct jackalope_object_t * jackalope_node_make(const char ** init_args_in);
 struct jackalope_source_t * jackalope_node_add_source(struct jackalope_object_t * object_in, const char * type_in, const char * name_in);
@@ -45,10 +78,30 @@ unsigned int jackalope_node_get_num_sources(struct jackalope_object_t * object_i
 struct jackalope_sink_t * jackalope_node_add_sink(struct jackalope_object_t * object_in, const char * type_in, const char * name_in);
 unsigned int jackalope_node_get_num_sinks(struct jackalope_object_t * object_in);
 void jackalope_node_link(struct jackalope_object_t * object_in, const char * source_in, struct jackalope_object_t * target_object_in, const char * sink_in);
+void jackalope_node_unlink(struct jackalope_object_t * object_in, const char * source_in, struct jackalope_object_t * target_object_in, const char * sink_in);
 void jackalope_node_forward(struct jackalope_object_t * object_in, const char * from_name_in, struct jackalope_object_t * target_object_in, const char * to_name_in);
 
 struct jackalope_object_t * jackalope_network_make_node(const char * init_args_in[]);
 
+// copies the latest readings of audio::meter nodes with out a job on
+// the async engine or any lock so polling never waits on audio threads;
+// an object that is not a meter gets a reading of all zeros with
+// blocks and num_bands set to 0
+void jackalope_meter_read(struct jackalope_object_t * meters_in[], const unsigned int num_meters_in, struct jackalope_meter_reading_t * readings_out);
+
+struct jackalope_batch_t * jackalope_batch_make(struct jackalope_object_t * graph_in);
+void jackalope_batch_delete(struct jackalope_batch_t * batch_in);
+unsigned int jackalope_batch_make_node(struct jackalope_batch_t * batch_in, const char * init_args_in[]);
+unsigned int jackalope_batch_link(struct jackalope_batch_t * batch_in, const char * from_in, const char * source_in, const char * to_in, const char * sink_in);
+unsigned int jackalope_batch_unlink(struct jackalope_batch_t * batch_in, const char * from_in, const char * source_in, const char * to_in, const char * sink_in);
+unsigned int jackalope_batch_remove_node(struct jackalope_batch_t * batch_in, const char * name_in);
+unsigned int jackalope_batch_forward(struct jackalope_batch_t * batch_in, const char * from_in, const char * source_in, const char * to_in, const char * sink_in);
+unsigned int jackalope_batch_poke(struct jackalope_batch_t * batch_in, const char * object_in, const char * property_in, const char * value_in);
+unsigned int jackalope_batch_subscribe(struct jackalope_batch_t * batch_in, const char * from_in, const char * signal_in, const char * to_in, const char * slot_in);
+unsigned int jackalope_batch_submit(struct jackalope_batch_t * batch_in);
+const char * jackalope_batch_get_error(struct jackalope_batch_t * batch_in, const unsigned int op_in);
+struct jackalope_object_t * jackalope_batch_get_node(struct jackalope_batch_t * batch_in, const unsigned int op_in);
+
 #ifdef __cplusplus
 }
 
@@ -72,13 +125,21 @@ struct jackalope_sink_t : public jackalope_wrapper_t<jackalope::sink_t> {
     jackalope_sink_t(jackalope::shared_t<jackalope::sink_t> wrapped_in);
 };
 
+struct jackalope_property_t : public jackalope_wrapper_t<jackalope::property_t> {
+    jackalope_property_t(jackalope::shared_t<jackalope::property_t> wrapped_in);
+};
+
 struct jackalope_object_t : public jackalope_wrapper_t<jackalope::object_t> {
     jackalope_object_t(jackalope::shared_t<jackalope::object_t> wrapped_in);
     virtual ~jackalope_object_t() = default;
     virtual void alias_property(const jackalope::string_t& property_name_in, jackalope_object_t& target_object_in, const jackalope::string_t& target_property_name_in);
     jackalope::string_t peek(const jackalope::string_t& property_name_in);
+    double peek_number(const jackalope::string_t& property_name_in);
+    void poke_numbers(const jackalope::pool_vector_t<std::pair<jackalope::string_t, double>>& values_in);
+    jackalope_property_t get_property(const jackalope::string_t& property_name_in);
     void poke(const jackalope::string_t& property_name_in, const double value_in);
     void poke(const jackalope::string_t& property_name_in, const jackalope::string_t& value_in);
+    void ramp(const jackalope::string_t& property_name_in, const jackalope::ramp_points_t& points_in);
     virtual void subscribe(const jackalope::string_t& signal_name_in, jackalope_object_t& target_object_in, const jackalope::string_t& slot_name_in);
     virtual void start();
     virtual void stop();
@@ -89,8 +150,11 @@ struct jackalope_object_t : public jackalope_wrapper_t<jackalope::object_t> {
         jackalope::promise_t<T> promise;
 
         wrapped->async_engine->submit_job([&] {
-            auto result = job_in();
-            promise.set_value(result);
+            try {
+                promise.set_value(job_in());
+            } catch (...) {
+                promise.set_exception(std::current_exception());
+            }
         });
 
         return promise.get_future().get();
@@ -101,8 +165,12 @@ struct jackalope_object_t : public jackalope_wrapper_t<jackalope::object_t> {
         jackalope::promise_t<void> promise;
 
         wrapped->async_engine->submit_job([&] {
-            job_in();
-            promise.set_value();
+            try {
+                job_in();
+                promise.set_value();
+            } catch (...) {
+                promise.set_exception(std::current_exception());
+            }
         });
 
         promise.get_future().get();
@@ -113,12 +181,15 @@ struct jackalope_graph_t : public jackalope_object_t {
 
     static jackalope_graph_t make(const jackalope::init_args_t& init_args_in);
     static jackalope_graph_t make(const jackalope::graph_t::prop_args_t& prop_args_in);
+    static jackalope_graph_t load(const jackalope::string_t& path_in);
     jackalope_graph_t(jackalope::shared_t<jackalope::graph_t> wrapped_in);
     virtual void add_property(const jackalope::string_t& name_in, jackalope::property_t::type_t type_in);
     virtual void add_property(const jackalope::string_t& name_in, jackalope::property_t::type_t type_in, const jackalope::init_args_t * init_args_in);
     virtual jackalope_node_t make_node(const jackalope::init_args_t& init_args_in);
     virtual void add_node(jackalope_node_t& node_in);
     virtual jackalope_network_t make_network(const jackalope::init_args_t& init_args_in);
+    virtual void remove_node(const jackalope::string_t& name_in);
+    virtual void replace_node(const jackalope::string_t& name_in, jackalope_node_t& node_in);
     virtual void run();
 };
 
@@ -132,6 +203,7 @@ struct jackalope_node_t : public jackalope_object_t {
     virtual jackalope::size_t get_num_sinks();
     virtual void activate();
     virtual void link(const jackalope::string_t& source_name_in, jackalope_object_t& target_object_in, const jackalope::string_t& target_sink_name_in);
+    virtual void unlink(const jackalope::string_t& source_name_in, jackalope_object_t& target_object_in, const jackalope::string_t& target_sink_name_in);
     virtual void forward(const jackalope::string_t& source_name_in, jackalope_node_t& target_node_in, const jackalope::string_t& target_sink_name_in);
 };
 
@@ -143,4 +215,62 @@ struct jackalope_network_t : public jackalope_node_t {
     virtual void add_property(const jackalope::string_t& name_in, jackalope::property_t::type_t type_in, const jackalope::init_args_t * init_args_in);
 };
 
+struct jackalope_watch_t {
+    struct entry_t {
+        jackalope::weak_t<jackalope::signal_t> signal;
+        jackalope::size_t callback_id;
+    };
+
+    int read_fd = -1;
+    int write_fd = -1;
+    jackalope::pool_vector_t<entry_t> entries;
+
+    jackalope_watch_t();
+    ~jackalope_watch_t();
+    void add(jackalope_object_t& object_in, const jackalope::string_t& signal_name_in, const unsigned int id_in);
+    jackalope::size_t read(unsigned int * ids_out, const jackalope::size_t max_ids_in);
+};
+
+// operations are queued then run in order as a single job on the
+// async engine with the graph locked; objects are named by node name
+// with an empty name meaning the graph itself. A failed operation stops
+// the batch and the operations after it are not run; nothing that
+// already ran is undone.
+struct jackalope_batch_t {
+
+    enum class op_type_t { make_node, remove_node, link, unlink, forward, poke, subscribe };
+
+    struct op_t {
+        op_type_t type;
+        jackalope::init_args_t init_args;
+        jackalope::string_t object;
+        jackalope::string_t name;
+        jackalope::string_t target;
+        jackalope::string_t target_name;
+    };
+
+    struct result_t {
+        bool done = false;
+        jackalope::string_t error;
+        jackalope::shared_t<jackalope::node_t> node = nullptr;
+    };
+
+    jackalope_graph_t graph;
+    jackalope::pool_vector_t<op_t> ops;
+    jackalope::pool_vector_t<result_t> results;
+
+    jackalope_batch_t(jackalope_graph_t& graph_in);
+    jackalope::size_t make_node(const jackalope::init_args_t& init_args_in);
+    jackalope::size_t link(const jackalope::string_t& from_in, const jackalope::string_t& source_in, const jackalope::string_t& to_in, const jackalope::string_t& sink_in);
+    jackalope::size_t remove_node(const jackalope::string_t& name_in);
+    jackalope::size_t unlink(const jackalope::string_t& from_in, const jackalope::string_t& source_in, const jackalope::string_t& to_in, const jackalope::string_t& sink_in);
+    jackalope::size_t forward(const jackalope::string_t& from_in, const jackalope::string_t& source_in, const jackalope::string_t& to_in, const jackalope::string_t& sink_in);
+    jackalope::size_t poke(const jackalope::string_t& object_in, const jackalope::string_t& property_in, const jackalope::string_t& value_in);
+    jackalope::size_t subscribe(const jackalope::string_t& from_in, const jackalope::string_t& signal_in, const jackalope::string_t& to_in, const jackalope::string_t& slot_in);
+    // returns the number of operations that completed
+    jackalope::size_t submit();
+    const result_t& get_result(const jackalope::size_t op_in);
+    void clear();
+};
+
 #endif // __cplusplus
@@ -11,11 +11,95 @@
 // GNU Lesser General Public License for more details.
 
 
+#include <chrono>
+#include <functional>
+#include <thread>
+
 #include <jackalope/graph.h>
 #include <jackalope/jackalope.h>
 
 namespace jackalope {
 
+using latency_map_t = pool_map_t<node_t *, size_t>;
+
+// returns the latency at the output of the node and sets the delay
+// on each link going into the node so every input lines up with the
+// slowest path
+static size_t compensate_node_latency(shared_t<node_t> node_in, latency_map_t& latencies_in)
+{
+    auto found = latencies_in.find(node_in.get());
+
+    if (found != latencies_in.end()) {
+        return found->second;
+    }
+
+    // a feedback loop reaches the node again before it is finished
+    // and is left uncompensated
+    latencies_in[node_in.get()] = 0;
+
+    pool_list_t<shared_t<link_t>> links;
+
+    guard_object(node_in, {
+        for(size_t i = 0; i < node_in->get_num_sinks(); i++) {
+            for(auto link : node_in->_get_sink(i)->get_links()) {
+                links.push_back(link);
+            }
+        }
+    });
+
+    pool_list_t<std::pair<shared_t<link_t>, size_t>> inputs;
+    size_t input_latency = 0;
+
+    for(auto link : links) {
+        auto source = link->get_from();
+
+        if (source == nullptr) {
+            continue;
+        }
+
+        auto upstream = dynamic_pointer_cast<node_t>(source->get_parent());
+
+        if (upstream == nullptr) {
+            continue;
+        }
+
+        auto upstream_latency = compensate_node_latency(upstream, latencies_in);
+        input_latency = std::max(input_latency, upstream_latency);
+        inputs.push_back({ link, upstream_latency });
+    }
+
+    for(auto& i : inputs) {
+        auto link = i.first;
+        auto delay = input_latency - i.second;
+
+        if (link->supports_delay()) {
+            link->set_delay(delay);
+        } else if (delay > 0) {
+            log_info("can not compensate ", delay, " samples of latency on link: ", link->description());
+        }
+
+        if (delay > 0) {
+            log_verbose("delaying link by ", delay, " samples: ", link->description());
+        }
+    }
+
+    auto output_latency = input_latency + node_in->get_latency();
+    latencies_in[node_in.get()] = output_latency;
+
+    return output_latency;
+}
+
+static shared_t<link_t> find_link(shared_t<source_t> source_in, shared_t<sink_t> sink_in)
+{
+    for(auto link : source_in->get_links()) {
+        if (link->get_to() == sink_in) {
+            return link;
+        }
+    }
+
+    throw_runtime_error("source is not linked to sink: ", source_in->name, " -> ", sink_in->name);
+}
+
 shared_t<graph_t> graph_t::make(const init_args_t& init_args_in)
 {
     auto graph = jackalope::make_shared<graph_t>(init_args_in);
@@ -73,37 +157,180 @@ void graph_t::add_node(shared_t<node_t> node_in)
 {
     assert_lockable_owner();
 
+    add_nodes({ node_in });
+}
+
+void graph_t::add_nodes(const pool_vector_t<shared_t<node_t>>& nodes_in)
+{
+    assert_lockable_owner();
+
     assert(init_flag);
 
     auto shared_this = shared_obj<graph_t>();
+    pool_map_t<string_t, bool> new_names;
+    async_join_t join(async_engine);
+
+    for(auto& node : nodes_in) {
+        if (nodes.find(node->name) != nodes.end() || ! new_names.emplace(node->name, true).second) {
+            throw_runtime_error("Can not add node with duplicate name to graph: ", node->name);
+        }
+
+        guard_object(node, {
+            if (node->get_graph() != shared_this) {
+                throw_runtime_error("Can not add an activated node to a graph if the node's graph is not us");
+            }
+
+            if (node->get_async_engine() != async_engine) {
+                node->set_async_engine(async_engine);
+            }
+
+            if (! node->is_activated()) {
+                bool activate_flag = true;
 
-    if (nodes.find(node_in->name) != nodes.end()) {
-        throw_runtime_error("Can not add node with duplicate name to graph: ", node_in->name);
+                if (init_args_has("node.activate", node->init_args)) {
+                    string_t should_activate = init_args_get("node.activate", node->init_args);
+
+                    if (should_activate != "true") {
+                        activate_flag = false;
+                    }
+                }
+
+                if (activate_flag) {
+                    join.add_job([node] {
+                        guard_object(node, { node->activate(); });
+                    });
+                }
+            }
+        });
     }
 
-    guard_object(node_in, {
-        if (node_in->get_graph() != shared_this) {
-            throw_runtime_error("Can not add an activated node to a graph if the node's graph is not us");
+    // nodes do not depend on each other until they are linked so
+    // they are all activated at the same time
+    join.run();
+
+    for(auto& node : nodes_in) {
+        nodes[node->name] = node;
+    }
+
+    // the slot table is left as it was if the nodes do not fit so
+    // taking them back out keeps the two in step
+    try {
+        update_shm();
+    } catch (...) {
+        for(auto& node : nodes_in) {
+            nodes.erase(node->name);
         }
 
-        if (! node_in->is_activated()) {
-            bool activate_flag = true;
+        throw;
+    }
+}
+
+shared_t<node_t> graph_t::get_node(const string_t& name_in)
+{
+    assert_lockable_owner();
 
-            if (init_args_has("node.activate", node_in->init_args)) {
-                string_t should_activate = init_args_get("node.activate", node_in->init_args);
+    auto found = nodes.find(name_in);
 
-                if (should_activate != "true") {
-                    activate_flag = false;
-                }
+    if (found == nodes.end()) {
+        throw_runtime_error("graph does not have a node named: ", name_in);
+    }
+
+    return found->second;
+}
+
+void graph_t::remove_node(const string_t& name_in)
+{
+    assert_lockable_owner();
+
+    auto node = get_node(name_in);
+
+    guard_object(node, {
+        for(size_t i = 0; i < node->get_num_sources(); i++) {
+            auto source = node->_get_source(i);
+
+            for(auto link : source->get_links()) {
+                source->unlink(link->get_to());
             }
+        }
+
+        for(size_t i = 0; i < node->get_num_sinks(); i++) {
+            auto sink = node->_get_sink(i);
 
-            if (activate_flag) {
-                node_in->activate();
+            for(auto link : sink->get_links()) {
+                link->get_from()->unlink(sink);
             }
         }
+
+        if (node->is_started() && ! node->is_stopped()) {
+            node->stop();
+        }
     });
 
-    nodes[node_in->name] = node_in;
+    nodes.erase(name_in);
+    update_shm();
+
+    object_log_info("removed node: ", name_in);
+}
+
+void graph_t::replace_node(const string_t& name_in, shared_t<node_t> new_node_in)
+{
+    assert_lockable_owner();
+
+    auto old_node = get_node(name_in);
+
+    if (old_node == new_node_in) {
+        throw_runtime_error("can not replace a node with itself: ", name_in);
+    }
+
+    if (get_node(new_node_in->name) != new_node_in) {
+        throw_runtime_error("replacement node must be added to the graph first: ", new_node_in->name);
+    }
+
+    {
+        auto old_lock = old_node->get_object_lock();
+        auto new_lock = new_node_in->get_object_lock();
+
+        pool_list_t<std::pair<shared_t<sink_t>, shared_t<sink_t>>> inputs;
+        pool_list_t<std::pair<shared_t<source_t>, shared_t<source_t>>> outputs;
+
+        // look up every channel on the replacement before changing
+        // anything so a missing name leaves the graph as it was
+        for(size_t i = 0; i < old_node->get_num_sinks(); i++) {
+            auto old_sink = old_node->_get_sink(i);
+            inputs.push_back({ old_sink, new_node_in->get_sink(old_sink->name) });
+        }
+
+        for(size_t i = 0; i < old_node->get_num_sources(); i++) {
+            auto old_source = old_node->_get_source(i);
+            outputs.push_back({ old_source, new_node_in->get_source(old_source->name) });
+        }
+
+        // the new link is made before the old one is removed so a block
+        // in flight on the old link can be moved over to it
+        for(auto& i : inputs) {
+            for(auto link : i.first->get_links()) {
+                auto upstream = link->get_from();
+                upstream->link(i.second);
+                link->transfer(find_link(upstream, i.second));
+                upstream->unlink(i.first);
+            }
+        }
+
+        for(auto& i : outputs) {
+            for(auto link : i.first->get_links()) {
+                auto downstream = link->get_to();
+                i.second->link(downstream);
+                link->transfer(find_link(i.second, downstream));
+                i.first->unlink(downstream);
+            }
+        }
+
+        if (started_flag && ! new_node_in->is_started()) {
+            new_node_in->start();
+        }
+    }
+
+    remove_node(name_in);
 }
 
 shared_t<node_t> graph_t::make_node(const init_args_t& init_args_in)
@@ -111,15 +338,29 @@ shared_t<node_t> graph_t::make_node(const init_args_t& init_args_in)
     assert_lockable_owner();
     assert(init_flag);
 
-    auto new_node = object_t::make<node_t>(init_args_in);
+    return make_nodes({ init_args_in })[0];
+}
 
-    guard_object(new_node, {
-        new_node->set_graph(shared_obj<graph_t>());
-    });
+pool_vector_t<shared_t<node_t>> graph_t::make_nodes(const pool_vector_t<init_args_t>& init_args_in)
+{
+    assert_lockable_owner();
+    assert(init_flag);
+
+    pool_vector_t<shared_t<node_t>> new_nodes;
+
+    for(auto& i : init_args_in) {
+        auto new_node = object_t::make<node_t>(i);
+
+        guard_object(new_node, {
+            new_node->set_graph(shared_obj<graph_t>());
+        });
+
+        new_nodes.push_back(new_node);
+    }
 
-    add_node(new_node);
+    add_nodes(new_nodes);
 
-    return new_node;
+    return new_nodes;
 }
 
 shared_t<network_t> graph_t::make_network(const init_args_t& init_args_in)
@@ -140,6 +381,106 @@ shared_t<network_t> graph_t::make_network(const init_args_t& init_args_in)
     return new_network;
 }
 
+void graph_t::load(shared_t<graph_file_t> file_in)
+{
+    assert_lockable_owner();
+    assert(init_flag);
+
+    pool_map_t<string_t, shared_t<node_t>> file_nodes;
+
+    // every level of the file is made with one call so the nodes in
+    // it are activated in parallel; networks are made first because
+    // their nodes go inside of them
+    std::function<void (shared_t<network_t>, const pool_list_t<graph_file_node_t>&)> make_file_nodes = [&](shared_t<network_t> network_in, const pool_list_t<graph_file_node_t>& nodes_in) {
+        pool_vector_t<const graph_file_node_t *> plain_nodes;
+        pool_vector_t<init_args_t> plain_args;
+
+        for(auto& i : nodes_in) {
+            if (network_in == nullptr && i.is_network()) {
+                file_nodes[i.get_name()] = make_network(i.init_args);
+            } else {
+                plain_nodes.push_back(&i);
+                plain_args.push_back(i.init_args);
+            }
+        }
+
+        pool_vector_t<shared_t<node_t>> made;
+
+        if (network_in == nullptr) {
+            made = make_nodes(plain_args);
+        } else {
+            made = guard_object(network_in, { return network_in->make_nodes(plain_args); });
+        }
+
+        for(size_t i = 0; i < made.size(); i++) {
+            file_nodes[plain_nodes[i]->get_name()] = made[i];
+        }
+
+        for(auto& i : nodes_in) {
+            if (i.nodes.size() == 0) {
+                continue;
+            }
+
+            auto network = dynamic_pointer_cast<network_t>(file_nodes[i.get_name()]);
+
+            if (network == nullptr) {
+                throw_runtime_error("only a network can contain nodes: ", i.get_name());
+            }
+
+            make_file_nodes(network, i.nodes);
+        }
+    };
+
+    make_file_nodes(nullptr, file_in->nodes);
+
+    for(auto& i : file_in->links) {
+        auto from = file_nodes[i.from];
+        auto to = file_nodes[i.to];
+
+        guard_object(from, {
+            guard_object(to, { from->link(i.from_name, to, i.to_name); });
+        });
+    }
+
+    for(auto& i : file_in->forwards) {
+        auto from = file_nodes[i.from];
+        auto to = file_nodes[i.to];
+
+        guard_object(from, {
+            guard_object(to, { from->forward(i.from_name, to, i.to_name); });
+        });
+    }
+
+    auto shared_this = shared_obj<graph_t>();
+
+    for(auto& i : file_in->subscriptions) {
+        shared_t<object_t> from = shared_this;
+        shared_t<object_t> to = shared_this;
+
+        if (i.from != "") {
+            from = file_nodes[i.from];
+        }
+
+        if (i.to != "") {
+            to = file_nodes[i.to];
+        }
+
+        if (from == shared_this && to == shared_this) {
+            subscribe(i.from_name, to, i.to_name);
+        } else if (from == shared_this) {
+            guard_object(to, { subscribe(i.from_name, to, i.to_name); });
+        } else if (to == shared_this) {
+            guard_object(from, { from->subscribe(i.from_name, to, i.to_name); });
+        } else {
+            guard_object(from, {
+                guard_object(to, { from->subscribe(i.from_name, to, i.to_name); });
+            });
+        }
+    }
+
+    object_log_info("loaded ", file_nodes.size(), " nodes from graph file");
+}
+
 void graph_t::init()
 {
     assert_lockable_owner();
@@ -147,6 +488,65 @@ void graph_t::init()
     object_t::init();
 
     get_property(JACKALOPE_PROPERTY_OBJECT_TYPE)->set(JACKALOPE_TYPE_GRAPH);
+
+    if (init_args_has(JACKALOPE_GRAPH_ARG_ASYNC_THREADS, init_args)) {
+        auto threads = init_args_get(JACKALOPE_GRAPH_ARG_ASYNC_THREADS, init_args);
+        set_async_engine(async_engine_t::admit({ { JACKALOPE_ASYNC_PROPERTY_THREADS, threads } }));
+    }
+
+    if (init_args_has(JACKALOPE_GRAPH_ARG_SHM_NAME, init_args)) {
+        auto shm_name = init_args_get(JACKALOPE_GRAPH_ARG_SHM_NAME, init_args);
+        size_t max_slots = JACKALOPE_SHM_DEFAULT_SLOTS;
+
+        if (init_args_has(JACKALOPE_GRAPH_ARG_SHM_SLOTS, init_args)) {
+            max_slots = std::stoul(init_args_get(JACKALOPE_GRAPH_ARG_SHM_SLOTS, init_args).c_str());
+        }
+
+        shm = jackalope::make_shared<shm_segment_t>(shm_name, max_slots);
+    }
+
+    if (init_args_has(JACKALOPE_GRAPH_ARG_WARM_UP_BLOCKS, init_args)) {
+        warm_up_blocks = std::stoul(init_args_get(JACKALOPE_GRAPH_ARG_WARM_UP_BLOCKS, init_args).c_str());
+    }
+
+    add_property(JACKALOPE_GRAPH_PROPERTY_WARM_UP_ALLOCATIONS, property_t::type_t::size);
+
+    add_property(JACKALOPE_PROPERTY_NODE_LATENCY, property_t::type_t::real)->set(0);
+}
+
+void graph_t::flatten_networks()
+{
+    assert_lockable_owner();
+
+    for(auto i : nodes) {
+        auto network = dynamic_pointer_cast<network_t>(i.second);
+
+        if (network != nullptr) {
+            guard_object(network, {
+                if (! network->is_started()) {
+                    network->flatten();
+                }
+            });
+        }
+    }
+}
+
+size_t graph_t::compensate_latency()
+{
+    assert_lockable_owner();
+
+    latency_map_t latencies;
+    size_t graph_latency = 0;
+
+    for(auto i : nodes) {
+        auto node_latency = compensate_node_latency(i.second, latencies);
+        graph_latency = std::max(graph_latency, node_latency);
+    }
+
+    get_property(JACKALOPE_PROPERTY_NODE_LATENCY)->set(graph_latency);
+    object_log_verbose("graph latency is ", graph_latency, " samples");
+
+    return graph_latency;
 }
 
 void graph_t::start()
@@ -155,12 +555,156 @@ void graph_t::start()
 
     object_t::start();
 
-    for(auto i : nodes) {
-        auto node = i.second;
-        guard_object(node, { node->start(); });
+    flatten_networks();
+    compensate_latency();
+
+    pool_vector_t<shared_t<node_t>> others;
+    pool_vector_t<shared_t<node_t>> driver_nodes;
+    pool_vector_t<shared_t<driver_t>> drivers;
+
+    for(auto& i : nodes) {
+        auto driver = dynamic_pointer_cast<driver_t>(i.second);
+
+        if (driver == nullptr) {
+            others.push_back(i.second);
+        } else {
+            driver_nodes.push_back(i.second);
+            drivers.push_back(driver);
+        }
+    }
+
+    if (warm_up_blocks > 0 && drivers.size() > 0) {
+        start_nodes(others);
+        warm_up(drivers);
+        // some nodes only know their latency once audio has gone
+        // through them
+        compensate_latency();
+        start_nodes(driver_nodes);
+    } else {
+        others.insert(others.end(), driver_nodes.begin(), driver_nodes.end());
+        start_nodes(others);
+    }
+
+    steady_allocations_base = get_pool_allocations();
+
+    if (shm != nullptr) {
+        update_shm();
+        shm->start();
     }
 }
 
+// nodes start on the async engine with each node waiting for the nodes
+// that feed its sinks so a node is never started before its inputs
+void graph_t::start_nodes(const pool_vector_t<shared_t<node_t>>& nodes_in)
+{
+    assert_lockable_owner();
+
+    async_join_t join(async_engine);
+    pool_map_t<shared_t<object_t>, size_t> jobs;
+
+    for(auto& node : nodes_in) {
+        jobs[node] = join.add_job([node] {
+            guard_object(node, { node->start(); });
+        });
+    }
+
+    for(auto& node : nodes_in) {
+        auto job = jobs[node];
+
+        guard_object(node, {
+            for(size_t j = 0; j < node->get_num_sinks(); j++) {
+                for(auto& link : node->_get_sink(j)->get_links()) {
+                    auto found = jobs.find(link->get_from()->get_parent());
+
+                    if (found != jobs.end()) {
+                        join.add_dependency(job, found->second);
+                    }
+                }
+            }
+        });
+    }
+
+    join.run();
+}
+
+// start() is often a job on the same engine the blocks need so the
+// engine is kept going from here while the driver is not ready
+bool graph_t::warm_up_wait(shared_t<driver_t> driver_in, const bool push_in)
+{
+    assert_lockable_owner();
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(JACKALOPE_DRIVER_WARM_UP_TIMEOUT_MS);
+
+    while(true) {
+        auto done = guard_object(driver_in, {
+            return push_in ? driver_in->warm_up_push() : driver_in->warm_up_pull();
+        });
+
+        if (done) {
+            return true;
+        }
+
+        if (std::chrono::steady_clock::now() >= deadline) {
+            return false;
+        }
+
+        if (! async_engine->poll_one()) {
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+    }
+}
+
+// the other nodes are running so the silent blocks go through the
+// same schedule as real periods; the pools keep the memory the blocks
+// needed and touch every page of it when they grow
+void graph_t::warm_up(const pool_vector_t<shared_t<driver_t>>& drivers_in)
+{
+    assert_lockable_owner();
+
+    auto start_allocations = get_pool_allocations();
+    size_t done = 0;
+
+    for(; done < warm_up_blocks; done++) {
+        bool kept_up = true;
+
+        for(auto& driver : drivers_in) {
+            kept_up = warm_up_wait(driver, true) && kept_up;
+        }
+
+        for(auto& driver : drivers_in) {
+            kept_up = warm_up_wait(driver, false) && kept_up;
+        }
+
+        if (! kept_up) {
+            object_log_error("warm up stopped after ", done, " blocks because the graph did not keep up");
+            break;
+        }
+    }
+
+    auto allocations = get_pool_allocations() - start_allocations;
+    get_property(JACKALOPE_GRAPH_PROPERTY_WARM_UP_ALLOCATIONS)->set(allocations);
+
+    object_log_info("warm up ran ", done, " blocks and the memory pools grew ", allocations, " times");
+}
+
+// the slot table follows the nodes while the graph runs
+void graph_t::update_shm()
+{
+    assert_lockable_owner();
+
+    if (shm == nullptr || ! started_flag || stopped_flag) {
+        return;
+    }
+
+    pool_vector_t<shared_t<node_t>> shm_nodes;
+
+    for(auto& i : nodes) {
+        shm_nodes.push_back(i.second);
+    }
+
+    shm->rebuild(shm_nodes);
+}
+
 void graph_t::stop()
 {
     assert_lockable_owner();
@@ -168,6 +712,10 @@ void graph_t::stop()
     assert(started_flag);
     assert(! stopped_flag);
 
+    if (shm != nullptr) {
+        shm->stop();
+    }
+
     for(auto i : nodes) {
         auto node = i.second;
 
@@ -180,6 +728,22 @@ void graph_t::stop()
     }
 
     object_t::stop();
+
+    if (steady_allocations_base > 0) {
+        object_log_info("the memory pools grew ", get_pool_allocations() - steady_allocations_base, " times while the graph ran");
+    }
+}
+
+pool_map_t<string_t, real_t> graph_t::get_stats()
+{
+    auto stats = object_t::get_stats();
+    size_t base = steady_allocations_base;
+
+    if (base > 0) {
+        stats.emplace(JACKALOPE_GRAPH_STAT_STEADY_ALLOCATIONS, get_pool_allocations() - base);
+    }
+
+    return stats;
 }
 
 } // namespace jackalope
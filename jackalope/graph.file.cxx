@@ -0,0 +1,239 @@
+// Jackalope Audio Engine
+// Copyright 2019 Tyler Riddle <kg7oem@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+
+
+#include <fstream>
+
+// the json parser still uses the global bind placeholders and boost
+// warns about that unless it is asked for them
+#define BOOST_BIND_GLOBAL_PLACEHOLDERS
+#include <boost/property_tree/json_parser.hpp>
+#include <boost/property_tree/ptree.hpp>
+
+#include <jackalope/exception.h>
+#include <jackalope/graph.file.h>
+#include <jackalope/network.h>
+#include <jackalope/node.h>
+#include <jackalope/object.h>
+
+namespace jackalope {
+
+using ptree_t = boost::property_tree::ptree;
+
+static string_t init_args_find(const char * name_in, const init_args_t& init_args_in)
+{
+    if (! init_args_has(name_in, &init_args_in)) {
+        return "";
+    }
+
+    return init_args_get(name_in, &init_args_in);
+}
+
+static init_args_t parse_init_args(const ptree_t& tree_in, const char * context_in)
+{
+    init_args_t init_args;
+
+    for(auto& i : tree_in) {
+        if (! i.second.empty()) {
+            throw_runtime_error("value must be a string or number: ", context_in, " ", i.first);
+        }
+
+        init_args.push_back({ string_t(i.first.c_str()), string_t(i.second.data().c_str()) });
+    }
+
+    return init_args;
+}
+
+static graph_file_node_t parse_node(const ptree_t& tree_in)
+{
+    graph_file_node_t node;
+
+    for(auto& i : tree_in) {
+        if (i.first == "nodes") {
+            for(auto& j : i.second) {
+                node.nodes.push_back(parse_node(j.second));
+            }
+
+            continue;
+        }
+
+        if (! i.second.empty()) {
+            throw_runtime_error("node argument must be a string or number: ", i.first);
+        }
+
+        node.init_args.push_back({ string_t(i.first.c_str()), string_t(i.second.data().c_str()) });
+    }
+
+    return node;
+}
+
+static pool_list_t<graph_file_connection_t> parse_connections(const ptree_t& tree_in, const char * section_in, const char * from_name_in, const char * to_name_in)
+{
+    pool_list_t<graph_file_connection_t> connections;
+    auto section = tree_in.get_child_optional(section_in);
+
+    if (! section) {
+        return connections;
+    }
+
+    for(auto& i : *section) {
+        auto& entry = i.second;
+        graph_file_connection_t connection;
+
+        connection.from = string_t(entry.get<std::string>("from", "").c_str());
+        connection.from_name = string_t(entry.get<std::string>(from_name_in, "").c_str());
+        connection.to = string_t(entry.get<std::string>("to", "").c_str());
+        connection.to_name = string_t(entry.get<std::string>(to_name_in, "").c_str());
+
+        if (connection.from_name == "" || connection.to_name == "") {
+            throw_runtime_error(section_in, " entries must specify ", from_name_in, " and ", to_name_in);
+        }
+
+        connections.push_back(connection);
+    }
+
+    return connections;
+}
+
+string_t graph_file_node_t::get_name() const
+{
+    return init_args_find(JACKALOPE_PROPERTY_NODE_NAME, init_args);
+}
+
+string_t graph_file_node_t::get_type() const
+{
+    return init_args_find(JACKALOPE_PROPERTY_OBJECT_TYPE, init_args);
+}
+
+bool graph_file_node_t::is_network() const
+{
+    return get_type() == JACKALOPE_OBJECT_TYPE_NETWORK;
+}
+
+shared_t<graph_file_t> graph_file_t::parse(std::istream& input_in)
+{
+    ptree_t tree;
+
+    try {
+        boost::property_tree::read_json(input_in, tree);
+    } catch (const boost::property_tree::json_parser_error& e) {
+        throw_runtime_error("could not parse graph file: ", e.what());
+    }
+
+    auto file = jackalope::make_shared<graph_file_t>();
+
+    if (auto graph = tree.get_child_optional("graph")) {
+        file->graph_args = parse_init_args(*graph, "graph");
+    }
+
+    if (auto nodes = tree.get_child_optional("nodes")) {
+        for(auto& i : *nodes) {
+            file->nodes.push_back(parse_node(i.second));
+        }
+    }
+
+    file->links = parse_connections(tree, "links", "source", "sink");
+    file->forwards = parse_connections(tree, "forwards", "source", "sink");
+    file->subscriptions = parse_connections(tree, "subscriptions", "signal", "slot");
+
+    file->validate();
+
+    return file;
+}
+
+shared_t<graph_file_t> graph_file_t::load(const string_t& path_in)
+{
+    std::ifstream input(path_in.c_str());
+
+    if (! input.is_open()) {
+        throw_runtime_error("could not open graph file: ", path_in);
+    }
+
+    return parse(input);
+}
+
+void graph_file_t::validate()
+{
+    pool_map_t<string_t, bool> names;
+    pool_list_t<const graph_file_node_t *> pending;
+
+    for(auto& i : nodes) {
+        pending.push_back(&i);
+    }
+
+    while(pending.size() > 0) {
+        auto node = pending.front();
+        pending.pop_front();
+
+        auto name = node->get_name();
+
+        if (name == "") {
+            throw_runtime_error("node in graph file must specify ", JACKALOPE_PROPERTY_NODE_NAME);
+        }
+
+        if (node->get_type() == "") {
+            throw_runtime_error("node in graph file must specify ", JACKALOPE_PROPERTY_OBJECT_TYPE, ": ", name);
+        }
+
+        if (names.find(name) != names.end()) {
+            throw_runtime_error("duplicate node name in graph file: ", name);
+        }
+
+        if (node->nodes.size() > 0 && ! node->is_network()) {
+            throw_runtime_error("only a network can contain nodes: ", name);
+        }
+
+        names[name] = true;
+
+        for(auto& i : node->nodes) {
+            pending.push_back(&i);
+        }
+    }
+
+    auto check_node = [&](const string_t& name_in, const char * section_in) {
+        if (names.find(name_in) == names.end()) {
+            throw_runtime_error("unknown node name in graph file ", section_in, ": ", name_in);
+        }
+    };
+
+    auto check_connections = [&](const pool_list_t<graph_file_connection_t>& connections_in, const char * section_in) {
+        for(auto& i : connections_in) {
+            check_node(i.from, section_in);
+            check_node(i.to, section_in);
+
+            // both ends get locked while connecting
+            if (i.from == i.to) {
+                throw_runtime_error("a node can not be connected to itself in graph file ", section_in, ": ", i.from);
+            }
+        }
+    };
+
+    check_connections(links, "links");
+    check_connections(forwards, "forwards");
+
+    for(auto& i : subscriptions) {
+        if (i.from != "") {
+            check_node(i.from, "subscriptions");
+        }
+
+        if (i.to != "") {
+            check_node(i.to, "subscriptions");
+        }
+
+        if (i.from != "" && i.from == i.to) {
+            throw_runtime_error("a node can not subscribe to itself in graph file: ", i.from);
+        }
+    }
+}
+
+} // namespace jackalope
@@ -0,0 +1,68 @@
+// Jackalope Audio Engine
+// Copyright 2019 Tyler Riddle <kg7oem@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+
+
+#pragma once
+
+#include <istream>
+
+#include <jackalope/string.h>
+#include <jackalope/types.h>
+
+// a graph file is JSON:
+//
+// {
+//     "graph": { "pcm.sample_rate": "48000" },
+//     "nodes": [
+//         { "object.type": "audio::sndfile", "node.name": "input", "config.path": "in.wav" },
+//         { "object.type": "jackalope::network", "node.name": "net", "nodes": [ ... ] }
+//     ],
+//     "links": [ { "from": "input", "source": "Output 1", "to": "net", "sink": "in" } ],
+//     "forwards": [ { "from": "net", "source": "in", "to": "inner", "sink": "input" } ],
+//     "subscriptions": [ { "from": "input", "signal": "object.stopped", "slot": "object.stop" } ]
+// }
+//
+// node names must be unique across the whole file including nodes inside
+// of networks; a subscription without "from" or "to" refers to the graph
+
+namespace jackalope {
+
+struct graph_file_node_t {
+    init_args_t init_args;
+    pool_list_t<graph_file_node_t> nodes;
+
+    string_t get_name() const;
+    string_t get_type() const;
+    bool is_network() const;
+};
+
+struct graph_file_connection_t {
+    string_t from;
+    string_t from_name;
+    string_t to;
+    string_t to_name;
+};
+
+struct graph_file_t : public base_t {
+    init_args_t graph_args;
+    pool_list_t<graph_file_node_t> nodes;
+    pool_list_t<graph_file_connection_t> links;
+    pool_list_t<graph_file_connection_t> forwards;
+    pool_list_t<graph_file_connection_t> subscriptions;
+
+    static shared_t<graph_file_t> parse(std::istream& input_in);
+    static shared_t<graph_file_t> load(const string_t& path_in);
+    void validate();
+};
+
+} // namespace jackalope
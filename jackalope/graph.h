@@ -12,13 +12,32 @@
 
 #pragma once
 
+#include <jackalope/graph.file.h>
 #include <jackalope/object.h>
 #include <jackalope/network.forward.h>
 #include <jackalope/node.h>
+#include <jackalope/plugin.h>
+#include <jackalope/shm.h>
 #include <jackalope/thread.h>
 #include <jackalope/types.h>
 
 #define JACKALOPE_TYPE_GRAPH "jackalope::graph"
+// giving a graph this init arg makes it run on its own async engine
+// with that many threads instead of sharing the default engine
+#define JACKALOPE_GRAPH_ARG_ASYNC_THREADS "async.threads"
+// publishes the node properties in a POSIX shared memory segment with
+// this name while the graph runs
+#define JACKALOPE_GRAPH_ARG_SHM_NAME "shm.name"
+#define JACKALOPE_GRAPH_ARG_SHM_SLOTS "shm.slots"
+// runs this many silent blocks from the drivers through the graph
+// before the drivers start; the other nodes are already running so a
+// node that makes audio on its own, like a file player, has its first
+// blocks used up by the warm up
+#define JACKALOPE_GRAPH_ARG_WARM_UP_BLOCKS "warm_up.blocks"
+// times the memory pools had to grow during the warm up and since
+// the drivers started
+#define JACKALOPE_GRAPH_PROPERTY_WARM_UP_ALLOCATIONS "state.allocations.warm_up"
+#define JACKALOPE_GRAPH_STAT_STEADY_ALLOCATIONS "state.allocations.steady"
 
 namespace jackalope {
 
@@ -31,6 +50,15 @@ public:
 
 protected:
     pool_map_t<string_t, shared_t<node_t>> nodes;
+    shared_t<shm_segment_t> shm = nullptr;
+    size_t warm_up_blocks = 0;
+    // zero until the drivers have started
+    atomic_t<size_t> steady_allocations_base = ATOMIC_VAR_INIT(0);
+
+    virtual void update_shm();
+    virtual void start_nodes(const pool_vector_t<shared_t<node_t>>& nodes_in);
+    virtual bool warm_up_wait(shared_t<driver_t> driver_in, const bool push_in);
+    virtual void warm_up(const pool_vector_t<shared_t<driver_t>>& drivers_in);
 
 public:
     static shared_t<graph_t> make(const init_args_t& init_args_in = {});
@@ -40,11 +68,32 @@ public:
     graph_t(const init_args_t * init_args_in);
     graph_t(const prop_args_t& prop_args_in);
     void add_node(shared_t<node_t> node_in);
+    // the nodes that need it are activated in parallel on the async
+    // engine; if any of them fails none of the nodes are added
+    void add_nodes(const pool_vector_t<shared_t<node_t>>& nodes_in);
+    shared_t<node_t> get_node(const string_t& name_in);
+    // the node is unlinked, stopped and dropped from the graph
+    void remove_node(const string_t& name_in);
+    // moves every link of the named node onto a replacement that is
+    // already in the graph then removes the old node; the replacement
+    // needs channels with the same names
+    void replace_node(const string_t& name_in, shared_t<node_t> new_node_in);
     shared_t<node_t> make_node(const init_args_t& init_args_in);
+    pool_vector_t<shared_t<node_t>> make_nodes(const pool_vector_t<init_args_t>& init_args_in);
     shared_t<network_t> make_network(const init_args_t& init_args_in);
+    // creates every node and connection in the file while the graph
+    // stays locked
+    void load(shared_t<graph_file_t> file_in);
     virtual void init() override;
+    // sets link delays so parallel paths arrive in step and returns
+    // the worst case latency in samples
+    virtual size_t compensate_latency();
+    // links the nodes on both sides of every network boundary to
+    // each other so blocks skip the network forwarding
+    virtual void flatten_networks();
     virtual void start() override;
     virtual void stop() override;
+    virtual pool_map_t<string_t, real_t> get_stats() override;
 };
 
 } // namespace jackalope
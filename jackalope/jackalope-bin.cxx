@@ -12,11 +12,13 @@
 // GNU Lesser General Public License for more details.
 
 #include <chrono>
+#include <cstdlib>
 #include <iostream>
 #include <string>
 
 #include <jackalope/jackalope.h>
 #include <jackalope/log/dest.h>
+#include <jackalope/log/ring.h>
 #include <jackalope/logging.h>
 #include <jackalope/object.h>
 
@@ -26,15 +28,40 @@
 
 using namespace jackalope::log;
 
+static void add_log_destinations()
+{
+    auto dest = jackalope::make_shared<console_dest_t>(level_t::info);
+    get_engine()->add_destination(dest);
+
+    auto ring_path = std::getenv("JACKALOPE_LOG_RING");
+    if (ring_path != nullptr) {
+        auto ring = jackalope::make_shared<ring_dest_t>(level_t::trace, ring_path);
+        get_engine()->add_destination(ring);
+    }
+}
+
+static int run_graph_file(const char * path_in)
+{
+    add_log_destinations();
+    jackalope_init();
+
+    auto graph = jackalope_graph_t::load(path_in);
+    graph.run();
+
+    return(0);
+}
+
 int main(int argc_in, char ** argv_in)
 {
-    if (argc_in != 2) {
-        jackalope_panic("must specify exactly one audio file to play");
+    if (argc_in == 3 && std::string(argv_in[1]) == "-g") {
+        return run_graph_file(argv_in[2]);
     }
 
-    auto dest = jackalope::make_shared<console_dest_t>(level_t::info);
-    get_engine()->add_destination(dest);
+    if (argc_in != 2) {
+        jackalope_panic("usage: jackalope <audio file> | jackalope -g <graph file>");
+    }
 
+    add_log_destinations();
     jackalope_init();
 
     auto graph = jackalope_graph_t::make({
@@ -0,0 +1,28 @@
+// Jackalope Audio Engine
+// Copyright 2019 Tyler Riddle <kg7oem@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+
+#include <iostream>
+
+#include <jackalope/jackalope.h>
+#include <jackalope/log/ring.h>
+
+int main(int argc_in, char ** argv_in)
+{
+    if (argc_in != 2) {
+        jackalope_panic("must specify exactly one log ring file to decode");
+    }
+
+    jackalope::log::decode_ring_file(argv_in[1], std::cout);
+
+    return(0);
+}
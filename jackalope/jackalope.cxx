@@ -12,10 +12,12 @@
 // GNU Lesser General Public License for more details.
 
 #include <jackalope/audio.h>
+#include <jackalope/control.h>
+#include <jackalope/midi.h>
 #include <jackalope/network.h>
 #include <jackalope/jackalope.h>
 
-#ifdef CONFIG_HAVE_DBUS
+#ifdef CONFIG_ENABLE_DBUS
 #include <jackalope/dbus.h>
 #endif
 
@@ -23,13 +25,15 @@ namespace jackalope {
 
 void init()
 {
-#ifdef CONFIG_HAVE_DBUS
+#ifdef CONFIG_ENABLE_DBUS
     jackalope::dbus_init();
 #endif
 
     jackalope::network_init();
 
     jackalope::audio_init();
+    jackalope::midi_init();
+    jackalope::control_init();
 }
 
 } // namespace jackalope
@@ -13,6 +13,7 @@
 #pragma once
 
 #include <jackalope/exception.h>
+#include <jackalope/symbol.h>
 #include <jackalope/thread.h>
 #include <jackalope/types.h>
 
@@ -25,7 +26,7 @@ public:
     using constructor_t = function_t<shared_t<T> (Args...)>;
 
 protected:
-    pool_map_t<string_t, constructor_t> constructors;
+    symbol_map_t<constructor_t> constructors;
 
 public:
     void add_constructor(const string_t& name_in, constructor_t constructor_in)
@@ -38,13 +39,14 @@ public:
     {
         assert_lockable_owner();
 
-        auto found = constructors.find(name_in);
+        auto symbol = symbol_t(name_in);
+        auto found = constructors.find(symbol);
 
         if (found != constructors.end()) {
             throw_runtime_error("Duplicate constructor for type: ", name_in);
         }
 
-        constructors.emplace(name_in, constructor_in);
+        constructors.emplace(symbol, constructor_in);
     }
 
     constructor_t get_constructor(const string_t& name_in)
@@ -57,7 +59,7 @@ public:
     {
         assert_lockable_owner();
 
-        auto found = constructors.find(name_in);
+        auto found = constructors.find(symbol_t::find(name_in));
 
         if (found == constructors.end()) {
             throw_runtime_error("Unknown constructor for type: ", name_in);
@@ -30,17 +30,45 @@ event_t::event_t(const char * source_in, const level_t& level_in, const timestam
 : source(source_in), level(level_in), when(when_in), tid(tid_in), function(function_in), file(file_in), line(line_in), message(message_in)
 { }
 
+// the common case of an event below the minimum level
+// is handled with out taking the engine lock
 bool engine_t::should_log(const level_t& level_in, const char_t * source_in)
 {
+    auto current_min_level = min_level.load(std::memory_order_relaxed);
+
+    if (current_min_level == level_t::uninit || level_in < current_min_level) {
+        return false;
+    }
+
+    if (! have_source_levels.load(std::memory_order_relaxed)) {
+        return true;
+    }
+
     auto lock = get_object_lock();
     return should_log__e(level_in, source_in);
 }
 
-bool engine_t::should_log__e(const level_t& level_in, const char_t *)
+bool engine_t::should_log__e(const level_t& level_in, const char_t * source_in)
 {
     assert_lockable_owner();
 
-    return level_in >= min_level;
+    auto current_min_level = min_level.load(std::memory_order_relaxed);
+
+    if (current_min_level == level_t::uninit || level_in < current_min_level) {
+        return false;
+    }
+
+    if (source_in == nullptr || source_levels.size() == 0) {
+        return true;
+    }
+
+    auto found = source_levels.find(source_in);
+
+    if (found == source_levels.end()) {
+        return true;
+    }
+
+    return level_in >= found->second;
 }
 
 void engine_t::deliver(const event_t& event_in)
@@ -68,6 +96,38 @@ void engine_t::add_destination(shared_t<dest_t> dest_in)
     add_destination__e(dest_in);
 }
 
+void engine_t::set_source_level(const char_t * source_in, const level_t level_in)
+{
+    auto lock = get_object_lock();
+    set_source_level__e(source_in, level_in);
+}
+
+void engine_t::set_source_level__e(const char_t * source_in, const level_t level_in)
+{
+    assert_lockable_owner();
+
+    assert(source_in != nullptr);
+
+    source_levels[source_in] = level_in;
+    have_source_levels = true;
+}
+
+void engine_t::clear_source_level(const char_t * source_in)
+{
+    auto lock = get_object_lock();
+    clear_source_level__e(source_in);
+}
+
+void engine_t::clear_source_level__e(const char_t * source_in)
+{
+    assert_lockable_owner();
+
+    assert(source_in != nullptr);
+
+    source_levels.erase(source_in);
+    have_source_levels = source_levels.size() > 0;
+}
+
 void engine_t::add_destination__e(shared_t<dest_t> dest_in)
 {
     assert_lockable_owner();
@@ -55,33 +55,47 @@ struct event_t : public base_t {
 class engine_t : public base_t, public lockable_t {
 
 protected:
-    level_t min_level = level_t::uninit;
+    atomic_t<level_t> min_level = ATOMIC_VAR_INIT(level_t::uninit);
+    atomic_t<bool> have_source_levels = ATOMIC_VAR_INIT(false);
     pool_vector_t<shared_t<dest_t>> destinations;
+    pool_map_t<string_t, level_t> source_levels;
 
     void update_min_level__e();
     bool should_log__e(const level_t& level_in, const char_t * source_in);
     void deliver__e(const event_t& event_in);
     void add_destination__e(shared_t<dest_t> dest_in);
+    void set_source_level__e(const char_t * source_in, const level_t level_in);
+    void clear_source_level__e(const char_t * source_in);
 
 public:
     bool should_log(const level_t& level_in, const char_t * source_in);
     void deliver(const event_t& event_in);
     void add_destination(shared_t<dest_t> dest_in);
+    void set_source_level(const char_t * source_in, const level_t level_in);
+    void clear_source_level(const char_t * source_in);
 };
 
 engine_t * get_engine();
 
+// does not check if the event should be logged; the logging macros
+// do that before any of the arguments are evaluated
 template<typename... Args>
-void send_vargs_event(const char * source_in, const level_t& level_in, const char *function_in, const char *path_in, const int& line_in, Args&&... args_in)
+void deliver_vargs_event(const char * source_in, const level_t& level_in, const char *function_in, const char *path_in, const int& line_in, Args&&... args_in)
 {
-    if (get_engine()->should_log(level_in, source_in)) {
-        auto when = std::chrono::system_clock::now();
+    auto when = std::chrono::system_clock::now();
 
-        auto tid = std::this_thread::get_id();
-        auto message = to_string(args_in...);
-        event_t event(source_in, level_in, when, tid, function_in, path_in, line_in, message);
+    auto tid = std::this_thread::get_id();
+    auto message = to_string(args_in...);
+    event_t event(source_in, level_in, when, tid, function_in, path_in, line_in, message);
+
+    get_engine()->deliver(event);
+}
 
-        get_engine()->deliver(event);
+template<typename... Args>
+void send_vargs_event(const char * source_in, const level_t& level_in, const char *function_in, const char *path_in, const int& line_in, Args&&... args_in)
+{
+    if (get_engine()->should_log(level_in, source_in)) {
+        deliver_vargs_event(source_in, level_in, function_in, path_in, line_in, args_in...);
     }
 
     return;
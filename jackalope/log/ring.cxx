@@ -0,0 +1,245 @@
+// Jackalope Audio Engine
+// Copyright 2019 Tyler Riddle <kg7oem@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <iomanip>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <jackalope/exception.h>
+#include <jackalope/log/ring.h>
+
+namespace jackalope {
+
+namespace log {
+
+static size_t ring_map_size(const size_t record_count_in, const size_t string_count_in)
+{
+    return sizeof(ring_header_t) + sizeof(ring_string_t) * string_count_in + sizeof(ring_record_t) * record_count_in;
+}
+
+static void * ring_map(const int fd_in, const size_t size_in, const int prot_in)
+{
+    auto map = mmap(nullptr, size_in, prot_in, MAP_SHARED, fd_in, 0);
+
+    if (map == MAP_FAILED) {
+        throw_runtime_error("could not mmap log ring file: ", strerror(errno));
+    }
+
+    return map;
+}
+
+static void copy_string(char * dest_in, const size_t dest_size_in, const char * source_in)
+{
+    std::strncpy(dest_in, source_in, dest_size_in - 1);
+    dest_in[dest_size_in - 1] = '\0';
+}
+
+ring_dest_t::ring_dest_t(const level_t min_level_in, const string_t& path_in, const size_t record_count_in, const size_t string_count_in)
+: dest_t(min_level_in), path(path_in)
+{
+    if (record_count_in == 0) {
+        throw_runtime_error("log ring must have at least one record");
+    }
+
+    map_size = ring_map_size(record_count_in, string_count_in);
+
+    auto old_path = path + JACKALOPE_LOG_RING_OLD_SUFFIX;
+    if (std::rename(path.c_str(), old_path.c_str()) != 0 && errno != ENOENT) {
+        throw_runtime_error("could not move old log ring file ", path, ": ", strerror(errno));
+    }
+
+    fd = open(path.c_str(), O_RDWR | O_CREAT | O_EXCL, 0644);
+    if (fd == -1) {
+        throw_runtime_error("could not open log ring file ", path, ": ", strerror(errno));
+    }
+
+    // allocate the blocks up front so writing a record never has to
+    // wait on the filesystem to find space
+    auto result = posix_fallocate(fd, 0, map_size);
+    if (result != 0 && ftruncate(fd, map_size) != 0) {
+        auto error = errno;
+        close(fd);
+        throw_runtime_error("could not size log ring file ", path, ": ", strerror(error));
+    }
+
+    try {
+        map = ring_map(fd, map_size, PROT_READ | PROT_WRITE);
+    } catch (...) {
+        close(fd);
+        throw;
+    }
+
+    std::memset(map, 0, map_size);
+
+    header = static_cast<ring_header_t *>(map);
+    strings = reinterpret_cast<ring_string_t *>(header + 1);
+    records = reinterpret_cast<ring_record_t *>(strings + string_count_in);
+
+    std::memcpy(header->magic, JACKALOPE_LOG_RING_MAGIC, sizeof(header->magic));
+    header->version = JACKALOPE_LOG_RING_VERSION;
+    header->record_size = sizeof(ring_record_t);
+    header->record_count = record_count_in;
+    header->string_count = string_count_in;
+}
+
+ring_dest_t::~ring_dest_t()
+{
+    if (map != nullptr) {
+        msync(map, map_size, MS_SYNC);
+        munmap(map, map_size);
+    }
+
+    if (fd != -1) {
+        close(fd);
+    }
+}
+
+void ring_dest_t::sync()
+{
+    auto lock = get_object_lock();
+    msync(map, map_size, MS_SYNC);
+}
+
+// strings are interned by address because the names come from
+// string literals at the call site
+uint32_t ring_dest_t::intern__e(const char * string_in)
+{
+    assert_lockable_owner();
+
+    if (string_in == nullptr) {
+        return JACKALOPE_LOG_RING_UNKNOWN_STRING;
+    }
+
+    auto found = string_ids.find(string_in);
+    if (found != string_ids.end()) {
+        return found->second;
+    }
+
+    if (header->strings_used >= header->string_count) {
+        return JACKALOPE_LOG_RING_UNKNOWN_STRING;
+    }
+
+    auto id = header->strings_used;
+    copy_string(strings[id].text, sizeof(strings[id].text), string_in);
+    header->strings_used++;
+    string_ids[string_in] = id;
+
+    return id;
+}
+
+void ring_dest_t::handle_event__e(const event_t& event_in)
+{
+    assert_lockable_owner();
+
+    auto sequence = ++header->next_sequence;
+    auto& record = records[(sequence - 1) % header->record_count];
+
+    record.sequence = 0;
+    record.when_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(event_in.when.time_since_epoch()).count();
+    record.tid = std::hash<thread_t::id>()(event_in.tid);
+    record.level = static_cast<int32_t>(event_in.level);
+    record.source_id = intern__e(event_in.source);
+    record.function_id = intern__e(event_in.function);
+    record.file_id = intern__e(event_in.file);
+    record.line = event_in.line;
+    record.message_size = std::min(event_in.message.size(), sizeof(record.message));
+    std::memcpy(record.message, event_in.message.data(), record.message_size);
+    record.sequence = sequence;
+}
+
+static const char * lookup_string(const ring_header_t * header_in, const ring_string_t * strings_in, const uint32_t id_in)
+{
+    if (id_in >= header_in->strings_used || id_in >= header_in->string_count) {
+        return "?";
+    }
+
+    return strings_in[id_in].text;
+}
+
+size_t decode_ring_file(const string_t& path_in, std::ostream& output_in)
+{
+    auto fd = open(path_in.c_str(), O_RDONLY);
+    if (fd == -1) {
+        throw_runtime_error("could not open log ring file ", path_in, ": ", strerror(errno));
+    }
+
+    struct stat file_stat;
+    if (fstat(fd, &file_stat) != 0 || static_cast<size_t>(file_stat.st_size) < sizeof(ring_header_t)) {
+        close(fd);
+        throw_runtime_error("log ring file is too small: ", path_in);
+    }
+
+    size_t map_size = file_stat.st_size;
+    void * map = nullptr;
+
+    try {
+        map = ring_map(fd, map_size, PROT_READ);
+    } catch (...) {
+        close(fd);
+        throw;
+    }
+
+    close(fd);
+
+    auto header = static_cast<const ring_header_t *>(map);
+
+    if (std::memcmp(header->magic, JACKALOPE_LOG_RING_MAGIC, sizeof(header->magic)) != 0
+        || header->version != JACKALOPE_LOG_RING_VERSION
+        || header->record_size != sizeof(ring_record_t)
+        || map_size < ring_map_size(header->record_count, header->string_count)) {
+        munmap(map, map_size);
+        throw_runtime_error("not a compatible log ring file: ", path_in);
+    }
+
+    auto strings = reinterpret_cast<const ring_string_t *>(header + 1);
+    auto records = reinterpret_cast<const ring_record_t *>(strings + header->string_count);
+
+    pool_vector_t<const ring_record_t *> valid;
+    for (size_t i = 0; i < header->record_count; i++) {
+        if (records[i].sequence != 0) {
+            valid.push_back(&records[i]);
+        }
+    }
+
+    std::sort(valid.begin(), valid.end(), [](const ring_record_t * a, const ring_record_t * b) {
+        return a->sequence < b->sequence;
+    });
+
+    for (auto&& record : valid) {
+        auto seconds = record->when_ns / 1000000000;
+        auto nanoseconds = record->when_ns % 1000000000;
+
+        output_in << record->sequence << " ";
+        output_in << seconds << "." << std::setw(9) << std::setfill('0') << nanoseconds << std::setfill(' ') << " ";
+        output_in << std::hex << record->tid << std::dec << " ";
+        output_in << record->level << " ";
+        output_in << lookup_string(header, strings, record->source_id) << " ";
+        output_in << lookup_string(header, strings, record->file_id) << ":" << record->line << " ";
+        output_in << lookup_string(header, strings, record->function_id) << ": ";
+        output_in.write(record->message, std::min(static_cast<size_t>(record->message_size), sizeof(record->message)));
+        output_in << std::endl;
+    }
+
+    munmap(map, map_size);
+
+    return valid.size();
+}
+
+} // namespace log
+
+} // namespace jackalope
@@ -0,0 +1,101 @@
+// Jackalope Audio Engine
+// Copyright 2019 Tyler Riddle <kg7oem@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+
+#pragma once
+
+#include <cstdint>
+#include <iostream>
+
+#include <jackalope/log/dest.h>
+#include <jackalope/string.h>
+#include <jackalope/types.h>
+
+namespace jackalope {
+
+namespace log {
+
+#define JACKALOPE_LOG_RING_MAGIC            "JKLRING1"
+#define JACKALOPE_LOG_RING_VERSION          1
+#define JACKALOPE_LOG_RING_STRING_SIZE      128
+#define JACKALOPE_LOG_RING_MESSAGE_SIZE     200
+#define JACKALOPE_LOG_RING_DEFAULT_RECORDS  16384
+#define JACKALOPE_LOG_RING_DEFAULT_STRINGS  1024
+#define JACKALOPE_LOG_RING_UNKNOWN_STRING   UINT32_MAX
+// a ring file left by an earlier run is moved to the same path with
+// this added so its records are still there after a crash and restart
+#define JACKALOPE_LOG_RING_OLD_SUFFIX       ".old"
+
+// all values in the ring file are in native byte order
+struct ring_header_t {
+    char magic[8];
+    uint32_t version;
+    uint32_t record_size;
+    uint32_t record_count;
+    uint32_t string_count;
+    uint32_t strings_used;
+    uint32_t reserved;
+    // total records ever written; the slot for a record is
+    // its sequence number modulo the record count
+    uint64_t next_sequence;
+};
+
+struct ring_string_t {
+    char text[JACKALOPE_LOG_RING_STRING_SIZE];
+};
+
+// a record is valid when its sequence is not 0; sequence numbers
+// start at 1 and are written after the rest of the record
+struct ring_record_t {
+    uint64_t sequence;
+    int64_t when_ns;
+    uint64_t tid;
+    int32_t level;
+    uint32_t source_id;
+    uint32_t function_id;
+    uint32_t file_id;
+    uint32_t line;
+    uint32_t message_size;
+    char message[JACKALOPE_LOG_RING_MESSAGE_SIZE];
+};
+
+// writes fixed size binary event records into a preallocated memory
+// mapped file that is reused as a ring; the source, function and file
+// names are interned into a string table inside the same file
+class ring_dest_t : public dest_t {
+
+protected:
+    const string_t path;
+    int fd = -1;
+    size_t map_size = 0;
+    void * map = nullptr;
+    ring_header_t * header = nullptr;
+    ring_string_t * strings = nullptr;
+    ring_record_t * records = nullptr;
+    pool_map_t<const char *, uint32_t> string_ids;
+
+    uint32_t intern__e(const char * string_in);
+
+public:
+    ring_dest_t(const level_t min_level_in, const string_t& path_in, const size_t record_count_in = JACKALOPE_LOG_RING_DEFAULT_RECORDS, const size_t string_count_in = JACKALOPE_LOG_RING_DEFAULT_STRINGS);
+    virtual ~ring_dest_t();
+    void handle_event__e(const event_t& event_in);
+    void sync();
+};
+
+// writes the records in a ring file to the stream from oldest to newest
+// and returns the number of records written
+size_t decode_ring_file(const string_t& path_in, std::ostream& output_in);
+
+} // namespace log
+
+} // namespace jackalope
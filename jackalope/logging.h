@@ -17,7 +17,19 @@
 
 #define JACKALOPE_LOG_NAME "jackalope"
 
-#define JACKALOPE_LOG_VARGS(logname, level_t, ...) jackalope::log::send_vargs_event(logname, level_t, __PRETTY_FUNCTION__, __FILE__, __LINE__, __VA_ARGS__)
+// log events below this level are removed at compile time
+#ifndef CONFIG_LOG_MIN_LEVEL
+#define CONFIG_LOG_MIN_LEVEL 0
+#endif
+
+#define JACKALOPE_LOG_ENABLED(level_t) (static_cast<int>(level_t) >= CONFIG_LOG_MIN_LEVEL)
+
+// arguments are only evaluated if the event will be logged
+#define JACKALOPE_LOG_VARGS(logname, level_t, ...) do { if (JACKALOPE_LOG_ENABLED(level_t) && jackalope::log::get_engine()->should_log(level_t, logname)) { jackalope::log::deliver_vargs_event(logname, level_t, __PRETTY_FUNCTION__, __FILE__, __LINE__, __VA_ARGS__); } } while (0)
 // #define JACKALOPE_LOG_LAMBDA(logname, level_t, block) jackalope::send_lambda_event(logname, level_t, __PRETTY_FUNCTION__, __FILE__, __LINE__, [&]() -> jackalope::string_t block)
 
+#define log_trace(...)    JACKALOPE_LOG_VARGS(JACKALOPE_LOG_NAME, jackalope::log::level_t::trace, __VA_ARGS__)
+#define log_debug(...)    JACKALOPE_LOG_VARGS(JACKALOPE_LOG_NAME, jackalope::log::level_t::debug, __VA_ARGS__)
+#define log_verbose(...)  JACKALOPE_LOG_VARGS(JACKALOPE_LOG_NAME, jackalope::log::level_t::verbose, __VA_ARGS__)
 #define log_info(...)     JACKALOPE_LOG_VARGS(JACKALOPE_LOG_NAME, jackalope::log::level_t::info, __VA_ARGS__)
+#define log_error(...)    JACKALOPE_LOG_VARGS(JACKALOPE_LOG_NAME, jackalope::log::level_t::error, __VA_ARGS__)
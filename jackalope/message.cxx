@@ -16,10 +16,10 @@
 
 namespace jackalope {
 
-abstract_message_t::abstract_message_t(const string_t& name_in)
+abstract_message_t::abstract_message_t(const string_t * name_in)
 : name(name_in)
 {
-    assert(name != "");
+    assert(name != nullptr && *name != "");
 }
 
 shared_t<abstract_message_handler_t> message_obj_t::get_message_handler(const string_t& name_in)
@@ -62,7 +62,7 @@ void message_obj_t::deliver_messages()
 
 void message_obj_t::deliver_one_message(shared_t<abstract_message_t> message_in)
 {
-    auto message_name = message_in->name;
+    auto& message_name = *message_in->name;
     auto message_handler = get_message_handler(message_name);
 
     message_handler->invoke(message_in);
@@ -23,9 +23,11 @@ namespace jackalope {
 class abstract_message_t : public base_t, public shared_obj_t<abstract_message_t> {
 
 public:
-    const string_t name;
+    // points to the static message_name of the message type so sending
+    // a message does not copy the name
+    const string_t * const name;
 
-    abstract_message_t(const string_t& name_in);
+    abstract_message_t(const string_t * name_in);
 };
 
 class abstract_message_handler_t : public base_t, public shared_obj_t<abstract_message_handler_t> {
@@ -38,7 +40,7 @@ template <typename... T>
 class message_t : public abstract_message_t {
 
 protected:
-    message_t(const string_t& name_in, T... args)
+    message_t(const string_t * name_in, T... args)
     : abstract_message_t(name_in), args(args_t(args...))
     { }
 
@@ -0,0 +1,334 @@
+// Jackalope Audio Engine
+// Copyright 2019 Tyler Riddle <kg7oem@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+
+
+#include <cassert>
+#include <cstring>
+
+#include <jackalope/midi.h>
+#include <jackalope/node.h>
+#include <jackalope/object.h>
+#include <jackalope/pcm.h>
+
+namespace jackalope {
+
+static shared_t<midi_source_t> midi_source_constructor(const string_t& name_in, shared_t<object_t> parent_in)
+{
+    return jackalope::make_shared<midi_source_t>(name_in, parent_in);
+}
+
+static shared_t<midi_sink_t> midi_sink_constructor(const string_t& name_in, shared_t<object_t> parent_in)
+{
+    return jackalope::make_shared<midi_sink_t>(name_in, parent_in);
+}
+
+void midi_init()
+{
+    add_source_constructor(JACKALOPE_TYPE_MIDI, midi_source_constructor);
+    add_sink_constructor(JACKALOPE_TYPE_MIDI, midi_sink_constructor);
+}
+
+bool midi_event_t::is_control_change() const
+{
+    return size == 3 && (data[0] & 0xF0) == JACKALOPE_MIDI_STATUS_CONTROL_CHANGE;
+}
+
+midi_buffer_t::midi_buffer_t(const size_t num_samples_in)
+: num_samples(num_samples_in)
+{
+    events.reserve(JACKALOPE_MIDI_BUFFER_EVENTS);
+}
+
+bool midi_buffer_t::add_event(const size_t frame_in, const uint8_t * data_in, const size_t size_in)
+{
+    if (events.size() == JACKALOPE_MIDI_BUFFER_EVENTS || size_in > JACKALOPE_MIDI_EVENT_MAX_SIZE) {
+        return false;
+    }
+
+    if (frame_in >= num_samples) {
+        throw_runtime_error("midi event frame is outside of the block: ", frame_in);
+    }
+
+    assert(events.size() == 0 || events.back().frame <= frame_in);
+
+    events.emplace_back();
+
+    auto& event = events.back();
+    event.frame = frame_in;
+    event.size = size_in;
+    std::memcpy(event.data, data_in, size_in);
+
+    return true;
+}
+
+bool midi_buffer_t::add_event(const midi_event_t& event_in)
+{
+    return add_event(event_in.frame, event_in.data, event_in.size);
+}
+
+size_t midi_buffer_t::get_num_events()
+{
+    return events.size();
+}
+
+const midi_event_t& midi_buffer_t::get_event(const size_t event_num_in)
+{
+    return events.at(event_num_in);
+}
+
+const midi_event_t * midi_buffer_t::begin()
+{
+    return events.data();
+}
+
+const midi_event_t * midi_buffer_t::end()
+{
+    return events.data() + events.size();
+}
+
+midi_link_t::midi_link_t(shared_t<source_t> source_in, shared_t<sink_t> sink_in)
+: link_t(source_in, sink_in)
+{
+    assert(source_in->type == sink_in->type);
+}
+
+bool midi_link_t::is_available()
+{
+    auto lock = get_object_lock();
+
+    return buffer == nullptr;
+}
+
+bool midi_link_t::is_ready()
+{
+    auto lock = get_object_lock();
+
+    return buffer != nullptr;
+}
+
+void midi_link_t::reset()
+{
+    auto source = guard_lockable({
+        assert(buffer != nullptr);
+
+        buffer = nullptr;
+
+        return get_from();
+    });
+
+    source->link_available(shared_obj());
+}
+
+void midi_link_t::set_buffer(shared_t<midi_buffer_t> buffer_in)
+{
+    auto lock = get_object_lock();
+
+    assert(buffer == nullptr);
+
+    buffer = buffer_in;
+}
+
+shared_t<midi_buffer_t> midi_link_t::get_buffer()
+{
+    auto lock = get_object_lock();
+
+    assert(buffer != nullptr);
+
+    return buffer;
+}
+
+void midi_link_t::transfer(shared_t<link_t> link_in)
+{
+    auto target = dynamic_pointer_cast<midi_link_t>(link_in);
+
+    assert(target != nullptr);
+
+    auto moved = guard_lockable({
+        if (buffer == nullptr) {
+            return false;
+        }
+
+        auto available = target->is_available();
+
+        if (available) {
+            target->set_buffer(buffer);
+        }
+
+        buffer = nullptr;
+
+        return available;
+    });
+
+    if (moved) {
+        link_in->get_to()->get_parent()->send_message<link_ready_message_t>(link_in);
+    }
+}
+
+midi_source_t::midi_source_t(const string_t name_in, shared_t<object_t> parent_in)
+: source_t(name_in, JACKALOPE_TYPE_MIDI, parent_in)
+{ }
+
+bool midi_source_t::_is_available()
+{
+    assert_lockable_owner();
+
+    for(auto& i : links) {
+        if (! i->is_available()) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+shared_t <link_t> midi_source_t::make_link(shared_t<source_t> from_in, shared_t<sink_t> to_in)
+{
+    return jackalope::make_shared<midi_link_t>(from_in, to_in);
+}
+
+void midi_source_t::link(shared_t<sink_t> sink_in)
+{
+    if (sink_in->type != JACKALOPE_TYPE_MIDI) {
+        throw_runtime_error("Incompatible types during link: ", type, " -> ", sink_in->type);
+    }
+
+    source_t::link(sink_in);
+}
+
+void midi_source_t::notify_buffer(shared_t<midi_buffer_t> buffer_in)
+{
+    auto lock = get_object_lock();
+    _notify_buffer(buffer_in);
+}
+
+void midi_source_t::_notify_buffer(shared_t<midi_buffer_t> buffer_in)
+{
+    assert_lockable_owner();
+
+    for(auto i : links) {
+        i->shared_obj<midi_link_t>()->set_buffer(buffer_in);
+    }
+
+    source_t::_notify();
+}
+
+midi_sink_t::midi_sink_t(const string_t name_in, shared_t<object_t> parent_in)
+: sink_t(name_in, JACKALOPE_TYPE_MIDI, parent_in)
+{ }
+
+shared_t<midi_buffer_t> midi_sink_t::get_buffer()
+{
+    auto lock = get_object_lock();
+
+    return _get_buffer();
+}
+
+shared_t<midi_buffer_t> midi_sink_t::_get_buffer()
+{
+    assert_lockable_owner();
+
+    auto buffer_size = get_parent()->get_property(JACKALOPE_PROPERTY_PCM_BUFFER_SIZE)->get_size();
+
+    if (links.size() == 0) {
+        return jackalope::make_shared<midi_buffer_t>(buffer_size);
+    } else if (links.size() == 1) {
+        return links.front()->shared_obj<midi_link_t>()->get_buffer();
+    }
+
+    // events from every link are merged in frame order
+    pool_vector_t<shared_t<midi_buffer_t>> buffers;
+    pool_vector_t<const midi_event_t *> positions;
+
+    for(auto& i : links) {
+        auto buffer = i->shared_obj<midi_link_t>()->get_buffer();
+        buffers.push_back(buffer);
+        positions.push_back(buffer->begin());
+    }
+
+    auto merged = jackalope::make_shared<midi_buffer_t>(buffer_size);
+
+    while(true) {
+        const midi_event_t * next = nullptr;
+        size_t next_num = 0;
+
+        for(size_t i = 0; i < buffers.size(); i++) {
+            if (positions[i] == buffers[i]->end()) {
+                continue;
+            }
+
+            if (next == nullptr || positions[i]->frame < next->frame) {
+                next = positions[i];
+                next_num = i;
+            }
+        }
+
+        if (next == nullptr) {
+            break;
+        }
+
+        merged->add_event(*next);
+        positions[next_num]++;
+    }
+
+    return merged;
+}
+
+bool midi_sink_t::_is_ready()
+{
+    assert_lockable_owner();
+
+    for(auto& i : links) {
+        if (! i->is_ready()) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool midi_sink_t::_is_available()
+{
+    assert_lockable_owner();
+
+    for(auto& i : links) {
+        if (i->is_ready()) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void midi_sink_t::_reset()
+{
+    assert_lockable_owner();
+
+    for(auto i : links) {
+        auto link = i->shared_obj<midi_link_t>();
+
+        if (! link->is_available()) {
+            link->reset();
+        }
+    }
+}
+
+void midi_sink_t::_forward(shared_t<source_t> source_in)
+{
+    assert_lockable_owner();
+
+    auto buffer = _get_buffer();
+
+    source_in->shared_obj<midi_source_t>()->notify_buffer(buffer);
+}
+
+} //namespace jackalope
@@ -0,0 +1,99 @@
+// Jackalope Audio Engine
+// Copyright 2019 Tyler Riddle <kg7oem@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+
+
+#pragma once
+
+#include <jackalope/channel.h>
+#include <jackalope/thread.h>
+#include <jackalope/types.h>
+
+#define JACKALOPE_TYPE_MIDI "midi"
+// events past this many in one block are dropped so adding an
+// event never allocates
+#define JACKALOPE_MIDI_BUFFER_EVENTS 256
+#define JACKALOPE_MIDI_EVENT_MAX_SIZE 3
+
+#define JACKALOPE_MIDI_STATUS_CONTROL_CHANGE 0xB0
+
+namespace jackalope {
+
+void midi_init();
+
+struct midi_event_t {
+    // sample offset inside of the block
+    size_t frame = 0;
+    size_t size = 0;
+    uint8_t data[JACKALOPE_MIDI_EVENT_MAX_SIZE] = { 0 };
+
+    bool is_control_change() const;
+};
+
+class midi_buffer_t : public base_t {
+
+protected:
+    pool_vector_t<midi_event_t> events;
+
+public:
+    const size_t num_samples;
+
+    midi_buffer_t(const size_t num_samples_in);
+    // events must be added in frame order; returns false if the
+    // event was dropped
+    bool add_event(const size_t frame_in, const uint8_t * data_in, const size_t size_in);
+    bool add_event(const midi_event_t& event_in);
+    size_t get_num_events();
+    const midi_event_t& get_event(const size_t event_num_in);
+    const midi_event_t * begin();
+    const midi_event_t * end();
+};
+
+class midi_link_t : public link_t, lockable_t {
+
+protected:
+    shared_t<midi_buffer_t> buffer = nullptr;
+
+public:
+    midi_link_t(shared_t<source_t> from_in, shared_t<sink_t> to_in);
+    virtual void reset();
+    virtual bool is_available() override;
+    virtual bool is_ready() override;
+    virtual shared_t<midi_buffer_t> get_buffer();
+    virtual void set_buffer(shared_t<midi_buffer_t> buffer_in);
+    virtual void transfer(shared_t<link_t> link_in) override;
+};
+
+class midi_source_t : public source_t {
+
+public:
+    midi_source_t(const string_t name_in, shared_t<object_t> parent_in);
+    virtual bool _is_available() override;
+    virtual shared_t<link_t> make_link(shared_t<source_t> from_in, shared_t<sink_t> to_in) override;
+    virtual void link(shared_t<sink_t> sink_in) override;
+    virtual void notify_buffer(shared_t<midi_buffer_t> buffer_in);
+    virtual void _notify_buffer(shared_t<midi_buffer_t> buffer_in);
+};
+
+class midi_sink_t : public sink_t {
+
+public:
+    midi_sink_t(const string_t name_in, shared_t<object_t> parent_in);
+    virtual shared_t<midi_buffer_t> get_buffer();
+    virtual shared_t<midi_buffer_t> _get_buffer();
+    virtual bool _is_available() override;
+    virtual bool _is_ready() override;
+    virtual void _reset() override;
+    virtual void _forward(shared_t<source_t> source_in) override;
+};
+
+} //namespace jackalope
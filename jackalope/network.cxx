@@ -61,7 +61,24 @@ void network_t::activate()
         set_undef_property(i);
     }
 
-    network_graph = graph_t::make(get_graph()->init_args);
+    // the inner graph runs on the same engine as the network and the
+    // outer graph already owns the shared memory segment and warm up
+    init_args_t graph_args;
+
+    for(auto& i : *get_graph()->init_args) {
+        if (i.first != JACKALOPE_GRAPH_ARG_ASYNC_THREADS
+            && i.first != JACKALOPE_GRAPH_ARG_SHM_NAME
+            && i.first != JACKALOPE_GRAPH_ARG_SHM_SLOTS
+            && i.first != JACKALOPE_GRAPH_ARG_WARM_UP_BLOCKS) {
+            graph_args.push_back(i);
+        }
+    }
+
+    network_graph = graph_t::make(graph_args);
+
+    guard_object(network_graph, {
+        network_graph->set_async_engine(async_engine);
+    });
 
     guard_object(network_graph, {
         network_graph->subscribe(JACKALOPE_SIGNAL_OBJECT_STOPPED, shared_obj(), JACKALOPE_SLOT_OBJECT_STOP);
@@ -115,6 +132,15 @@ shared_t<node_t> network_t::make_node(const init_args_t& init_args_in)
     });
 }
 
+pool_vector_t<shared_t<node_t>> network_t::make_nodes(const pool_vector_t<init_args_t>& init_args_in)
+{
+    assert_lockable_owner();
+
+    return guard_object(network_graph, {
+        return network_graph->make_nodes(init_args_in);
+    });
+}
+
 shared_t<source_t> network_t::add_source(const string_t& source_name_in, const string_t& type_in)
 {
     assert_lockable_owner();
@@ -140,16 +166,18 @@ shared_t<sink_t> network_t::_get_forward_sink(const string_t& source_name_in)
     return source_forward_sinks[source_name_in];
 }
 
+// forward channels have the same name as the channel they
+// belong to so the lookup is by name
 bool network_t::is_forward_sink(shared_t<sink_t> sink_in) {
     assert_lockable_owner();
 
-    for(auto i : source_forward_sinks) {
-        if (i.second == sink_in) {
-            return true;
-        }
+    auto found = source_forward_sinks.find(sink_in->name);
+
+    if (found == source_forward_sinks.end()) {
+        return false;
     }
 
-    return false;
+    return found->second == sink_in;
 }
 
 shared_t<sink_t> network_t::add_sink(const string_t& sink_name_in, const string_t& type_in)
@@ -180,13 +208,13 @@ shared_t<source_t> network_t::_get_forward_source(const string_t& sink_name_in)
 bool network_t::is_forward_source(shared_t<source_t> source_in) {
     assert_lockable_owner();
 
-    for(auto i : sink_forward_sources) {
-        if (i.second == source_in) {
-            return true;
-        }
+    auto found = sink_forward_sources.find(source_in->name);
+
+    if (found == sink_forward_sources.end()) {
+        return false;
     }
 
-    return false;
+    return found->second == source_in;
 }
 
 void network_t::forward(const string_t& sink_name_in, shared_t<node_t> target_node_in, const string_t& target_sink_name_in)
@@ -203,6 +231,130 @@ void network_t::forward(const string_t& sink_name_in, shared_t<node_t> target_no
     forward_source->link(target_sink);
 }
 
+// the forward channels are left without links once a channel is
+// flattened so the inner channels are remembered and later links are
+// made to them directly; a channel with nothing on one side is left
+// to work through its forward channel
+void network_t::flatten()
+{
+    assert_lockable_owner();
+
+    if (started_flag) {
+        throw_runtime_error("can not flatten a network that has started");
+    }
+
+    guard_object(network_graph, { network_graph->flatten_networks(); });
+
+    for(auto& i : sink_forward_sources) {
+        auto sink = get_sink(i.first);
+        auto forward_source = i.second;
+        auto outer_links = sink->get_links();
+        auto inner_links = forward_source->get_links();
+
+        if (outer_links.size() == 0 || inner_links.size() == 0) {
+            continue;
+        }
+
+        for(auto outer : outer_links) {
+            auto upstream = outer->get_from();
+
+            for(auto inner : inner_links) {
+                upstream->link(inner->get_to());
+            }
+
+            upstream->unlink(sink);
+        }
+
+        auto& inner_sinks = flattened_sinks[i.first];
+
+        for(auto inner : inner_links) {
+            inner_sinks.push_back(inner->get_to());
+            forward_source->unlink(inner->get_to());
+        }
+
+        object_log_verbose("flattened sink: ", i.first);
+    }
+
+    for(auto& i : source_forward_sinks) {
+        auto source = get_source(i.first);
+        auto forward_sink = i.second;
+        auto outer_links = source->get_links();
+        auto inner_links = forward_sink->get_links();
+
+        if (outer_links.size() == 0 || inner_links.size() == 0) {
+            continue;
+        }
+
+        auto& inner_sources = flattened_sources[i.first];
+
+        for(auto inner : inner_links) {
+            auto inner_source = inner->get_from();
+
+            for(auto outer : outer_links) {
+                inner_source->link(outer->get_to());
+            }
+
+            inner_sources.push_back(inner_source);
+            inner_source->unlink(forward_sink);
+        }
+
+        for(auto outer : outer_links) {
+            source->unlink(outer->get_to());
+        }
+
+        object_log_verbose("flattened source: ", i.first);
+    }
+}
+
+pool_vector_t<shared_t<sink_t>> network_t::_get_link_sinks(const string_t& sink_name_in)
+{
+    assert_lockable_owner();
+
+    auto found = flattened_sinks.find(sink_name_in);
+
+    if (found == flattened_sinks.end()) {
+        return node_t::_get_link_sinks(sink_name_in);
+    }
+
+    return found->second;
+}
+
+void network_t::link(const string_t& source_name_in, shared_t<node_t> target_node_in, const string_t& target_sink_name_in)
+{
+    assert_lockable_owner();
+
+    auto found = flattened_sources.find(source_name_in);
+
+    if (found == flattened_sources.end()) {
+        node_t::link(source_name_in, target_node_in, target_sink_name_in);
+        return;
+    }
+
+    for(auto inner_source : found->second) {
+        for(auto target_sink : target_node_in->_get_link_sinks(target_sink_name_in)) {
+            inner_source->link(target_sink);
+        }
+    }
+}
+
+void network_t::unlink(const string_t& source_name_in, shared_t<node_t> target_node_in, const string_t& target_sink_name_in)
+{
+    assert_lockable_owner();
+
+    auto found = flattened_sources.find(source_name_in);
+
+    if (found == flattened_sources.end()) {
+        node_t::unlink(source_name_in, target_node_in, target_sink_name_in);
+        return;
+    }
+
+    for(auto inner_source : found->second) {
+        for(auto target_sink : target_node_in->_get_link_sinks(target_sink_name_in)) {
+            inner_source->unlink(target_sink);
+        }
+    }
+}
+
 void network_t::source_available(shared_t<source_t> source_in)
 {
     assert_lockable_owner();
@@ -212,10 +364,10 @@ void network_t::source_available(shared_t<source_t> source_in)
     shared_t<sink_t> sink;
 
     if (is_forward_source(source_in)) {
-        object_log_info("forward source is available: ", source_in->name);
+        object_log_trace("forward source is available: ", source_in->name);
         sink = get_sink(source_in->name);
     } else {
-        object_log_info("regular source is available: ", source_in->name);
+        object_log_trace("regular source is available: ", source_in->name);
         sink = get_forward_sink(source_in->name);
     }
 
@@ -236,7 +388,7 @@ void network_t::sink_ready(shared_t<sink_t> sink_in)
         source = get_forward_source(sink_in->name);
     }
 
-    object_log_info("forwarding sink: ", sink_in->name);
+    object_log_trace("forwarding sink: ", sink_in->name);
     sink_in->forward(source);
 }
 
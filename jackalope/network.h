@@ -29,6 +29,10 @@ protected:
     shared_t<graph_t> network_graph = nullptr;
     pool_map_t<string_t, shared_t<sink_t>> source_forward_sinks;
     pool_map_t<string_t, shared_t<source_t>> sink_forward_sources;
+    // the inner channels on the other side of each flattened sink and
+    // source that new links are made to instead
+    pool_map_t<string_t, pool_vector_t<shared_t<sink_t>>> flattened_sinks;
+    pool_map_t<string_t, pool_vector_t<shared_t<source_t>>> flattened_sources;
 
 public:
     static shared_t<network_t> make(const init_args_t& init_args_in);
@@ -40,10 +44,18 @@ public:
     virtual shared_t<property_t> add_property(const string_t& name_in, property_t::type_t type_in) override;
     virtual shared_t<property_t> add_property(const string_t& name_in, property_t::type_t type_in, const init_args_t * init_args_in)  override;
     virtual shared_t<node_t> make_node(const init_args_t& init_args_in);
+    virtual pool_vector_t<shared_t<node_t>> make_nodes(const pool_vector_t<init_args_t>& init_args_in);
     virtual shared_t<source_t> add_source(const string_t& source_name_in, const string_t& type_in) override;
     virtual shared_t<sink_t> add_sink(const string_t& sink_name_in, const string_t& type_in) override;
 
     virtual void forward(const string_t& sink_name_in, shared_t<node_t> target_node_in, const string_t& target_sink_name_in) override;
+    // replaces the forward hops at the edge of the network with direct
+    // links between the nodes on either side; links made to or from a
+    // flattened channel later on are made directly as well
+    virtual void flatten();
+    virtual pool_vector_t<shared_t<sink_t>> _get_link_sinks(const string_t& sink_name_in) override;
+    virtual void link(const string_t& source_name_in, shared_t<node_t> target_node_in, const string_t& target_sink_name_in) override;
+    virtual void unlink(const string_t& source_name_in, shared_t<node_t> target_node_in, const string_t& target_sink_name_in) override;
     virtual bool is_forward_sink(shared_t<sink_t> sink_in);
     virtual bool is_forward_source(shared_t<source_t> source_in);
     virtual shared_t<sink_t> _get_forward_sink(const string_t& source_name_in) override;
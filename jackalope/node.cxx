@@ -85,13 +85,15 @@ void node_t::set_graph(shared_t<graph_t> graph_in)
     assert(graph_in != nullptr);
 
     graph = graph_in;
+    set_async_engine(graph_in->get_async_engine());
 }
 
 shared_t<source_t> node_t::add_source(const string_t& source_name_in, const string_t& type_in)
 {
     assert_lockable_owner();
 
-    auto found = sources_by_name.find(source_name_in);
+    auto symbol = symbol_t(source_name_in);
+    auto found = sources_by_name.find(symbol);
 
     if (found != sources_by_name.end()) {
         throw_runtime_error("Can not add duplicate source name: ", source_name_in);
@@ -99,7 +101,7 @@ shared_t<source_t> node_t::add_source(const string_t& source_name_in, const stri
 
     auto new_source = source_t::make(source_name_in, type_in, shared_obj());
     sources.push_back(new_source);
-    sources_by_name[new_source->name] = new_source;
+    sources_by_name[symbol] = new_source;
 
     return new_source;
 }
@@ -108,6 +110,19 @@ shared_t<source_t> node_t::_get_source(const string_t& source_name_in)
 {
     assert_lockable_owner();
 
+    auto symbol = symbol_t::find(source_name_in);
+
+    if (! symbol.is_valid()) {
+        throw_runtime_error("Unknown source name: ", source_name_in);
+    }
+
+    return _get_source(symbol);
+}
+
+shared_t<source_t> node_t::_get_source(const symbol_t& source_name_in)
+{
+    assert_lockable_owner();
+
     auto found = sources_by_name.find(source_name_in);
 
     if (found == sources_by_name.end()) {
@@ -139,7 +154,8 @@ shared_t<sink_t> node_t::add_sink(const string_t& sink_name_in, const string_t&
 {
     assert_lockable_owner();
 
-    auto found = sinks_by_name.find(sink_name_in);
+    auto symbol = symbol_t(sink_name_in);
+    auto found = sinks_by_name.find(symbol);
 
     if (found != sinks_by_name.end()) {
         throw_runtime_error("Can not add duplicate sink name: ", sink_name_in);
@@ -147,7 +163,7 @@ shared_t<sink_t> node_t::add_sink(const string_t& sink_name_in, const string_t&
 
     auto new_source = sink_t::make(sink_name_in, type_in, shared_obj());
     sinks.push_back(new_source);
-    sinks_by_name[new_source->name] = new_source;
+    sinks_by_name[symbol] = new_source;
 
     return new_source;
 }
@@ -156,6 +172,19 @@ shared_t<sink_t> node_t::_get_sink(const string_t& sink_name_in)
 {
     assert_lockable_owner();
 
+    auto symbol = symbol_t::find(sink_name_in);
+
+    if (! symbol.is_valid()) {
+        throw_runtime_error("Unknown sink name: ", sink_name_in);
+    }
+
+    return _get_sink(symbol);
+}
+
+shared_t<sink_t> node_t::_get_sink(const symbol_t& sink_name_in)
+{
+    assert_lockable_owner();
+
     assert(activated_flag);
 
     auto found = sinks_by_name.find(sink_name_in);
@@ -180,6 +209,46 @@ shared_t<sink_t> node_t::_get_sink(const size_t sink_num_in)
     return sinks[sink_num_in];
 }
 
+size_t node_t::get_latency()
+{
+    if (! has_property(JACKALOPE_PROPERTY_NODE_LATENCY)) {
+        return 0;
+    }
+
+    auto property = get_property(JACKALOPE_PROPERTY_NODE_LATENCY);
+
+    if (! property->is_defined()) {
+        return 0;
+    }
+
+    auto latency = property->get_real();
+
+    if (latency <= 0) {
+        return 0;
+    }
+
+    return std::lround(latency);
+}
+
+bool node_t::has_links()
+{
+    assert_lockable_owner();
+
+    for(auto i : sources) {
+        if (i->has_links()) {
+            return true;
+        }
+    }
+
+    for(auto i : sinks) {
+        if (i->has_links()) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
 size_t node_t::get_num_sinks()
 {
     assert_lockable_owner();
@@ -195,10 +264,26 @@ void node_t::link(const string_t& source_name_in, shared_t<node_t> target_node_i
         throw_runtime_error("can't invoke link on a node that is not activated");
     }
 
-    auto target_sink = target_node_in->get_sink(target_sink_name_in);
     auto source = get_source(source_name_in);
 
-    source->link(target_sink);
+    for(auto target_sink : target_node_in->_get_link_sinks(target_sink_name_in)) {
+        source->link(target_sink);
+    }
+}
+
+void node_t::unlink(const string_t& source_name_in, shared_t<node_t> target_node_in, const string_t& target_sink_name_in)
+{
+    assert_lockable_owner();
+
+    if (! activated_flag) {
+        throw_runtime_error("can't invoke unlink on a node that is not activated");
+    }
+
+    auto source = get_source(source_name_in);
+
+    for(auto target_sink : target_node_in->_get_link_sinks(target_sink_name_in)) {
+        source->unlink(target_sink);
+    }
 }
 
 void node_t::forward(const string_t& source_name_in, shared_t<node_t> target_node_in, const string_t& target_source_name_in)
@@ -225,6 +310,13 @@ shared_t<source_t> node_t::_get_forward_source(const string_t&)
     throw_runtime_error("can not get forward source for a jackalope::node");
 }
 
+pool_vector_t<shared_t<sink_t>> node_t::_get_link_sinks(const string_t& sink_name_in)
+{
+    assert_lockable_owner();
+
+    return { _get_sink(sink_name_in) };
+}
+
 void node_t::init()
 {
     assert_lockable_owner();
@@ -283,9 +375,9 @@ void node_t::start()
 
 void node_t::deliver_one_message(shared_t<abstract_message_t> message_in)
 {
-    auto message_name = message_in->name;
+    auto& message_name = *message_in->name;
 
-    object_log_info("delivering message: ", message_name);
+    object_log_trace("delivering message: ", message_name);
 
     object_t::deliver_one_message(message_in);
 }
@@ -311,11 +403,11 @@ void node_t::message_link_ready(shared_t<link_t> link_in)
     assert(sink->get_parent() == shared_obj());
 
     if (! link_in->is_ready()) {
-        object_log_info("ignoring link ready message because link is not ready");
+        object_log_trace("ignoring link ready message because link is not ready");
         return;
     }
 
-    object_log_info("link is now ready for sink: ", sink->name);
+    object_log_trace("link is now ready for sink: ", sink->name);
 
     sink->link_ready(link_in);
 }
@@ -335,7 +427,7 @@ void node_t::sink_ready(shared_t<sink_t> sink_in)
 {
     assert_lockable_owner();
 
-    object_log_info("sink is ready: ", sink_in->name);
+    object_log_trace("sink is ready: ", sink_in->name);
 }
 
 void node_t::message_source_available(shared_t<source_t> source_in)
@@ -353,7 +445,7 @@ void node_t::source_available(shared_t<source_t> source_in)
 {
     assert_lockable_owner();
 
-    object_log_info("source is available: ", source_in->name);
+    object_log_trace("source is available: ", source_in->name);
 }
 
 } //namespace jackalope
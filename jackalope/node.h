@@ -20,7 +20,8 @@
 #include <jackalope/object.h>
 #include <jackalope/types.h>
 
-#define JACKALOPE_PROPERTY_NODE_NAME "node.name"
+#define JACKALOPE_PROPERTY_NODE_NAME     "node.name"
+#define JACKALOPE_PROPERTY_NODE_LATENCY  "state.latency"
 
 namespace jackalope {
 
@@ -30,9 +31,9 @@ protected:
     bool activated_flag = false;
     weak_t<graph_t> graph;
     pool_vector_t<shared_t<source_t>> sources;
-    pool_map_t<string_t, shared_t<source_t>> sources_by_name;
+    symbol_map_t<shared_t<source_t>> sources_by_name;
     pool_vector_t<shared_t<sink_t>> sinks;
-    pool_map_t<string_t, shared_t<sink_t>> sinks_by_name;
+    symbol_map_t<shared_t<sink_t>> sinks_by_name;
 
     node_t(const string_t& type_in, const init_args_t& init_args_in);
     node_t(const init_args_t& init_args_in);
@@ -54,10 +55,15 @@ public:
     virtual void set_undef_property(const string_t& name_in);
 
     virtual bool is_activated();
+    // in samples; read from JACKALOPE_PROPERTY_NODE_LATENCY when the
+    // node has it
+    virtual size_t get_latency();
+    virtual bool has_links();
 
     virtual size_t get_num_sources();
     virtual shared_t<source_t> add_source(const string_t& source_name_in, const string_t& type_in);
     virtual shared_t<source_t> _get_source(const string_t& source_name_in);
+    virtual shared_t<source_t> _get_source(const symbol_t& source_name_in);
     virtual shared_t<source_t> _get_source(const size_t source_num_in);
 
     template <class T = source_t, typename... Args>
@@ -69,9 +75,12 @@ public:
     virtual size_t get_num_sinks();
     virtual shared_t<sink_t> add_sink(const string_t& sink_name_in, const string_t& type_in);
     virtual shared_t<sink_t> _get_sink(const string_t& sink_name_in);
+    virtual shared_t<sink_t> _get_sink(const symbol_t& sink_name_in);
     virtual shared_t<sink_t> _get_sink(const size_t sink_num_in);
     virtual shared_t<sink_t> _get_forward_sink(const string_t& source_name_in);
     virtual shared_t<source_t> _get_forward_source(const string_t& sink_name_in);
+    // the sinks a link to the named sink ends up on
+    virtual pool_vector_t<shared_t<sink_t>> _get_link_sinks(const string_t& sink_name_in);
 
     template <class T = sink_t, typename... Args>
     shared_t<T> get_sink(Args... args)
@@ -92,6 +101,7 @@ public:
     }
 
     virtual void link(const string_t& source_name_in, shared_t<node_t> target_node_in, const string_t& target_sink_name_in);
+    virtual void unlink(const string_t& source_name_in, shared_t<node_t> target_node_in, const string_t& target_sink_name_in);
     virtual void forward(const string_t& source_name_in, shared_t<node_t> target_network_in, const string_t& target_source_name_in);
     virtual void init() override;
     virtual void activate();
@@ -35,10 +35,10 @@ size_t _get_object_id()
 
 const string_t invoke_slot_message_t::message_name = JACKALOPE_MESSAGE_OBJECT_INVOKE_SLOT;
 
-invoke_slot_message_t::invoke_slot_message_t(const string_t& slot_name_in)
-: message_t(JACKALOPE_MESSAGE_OBJECT_INVOKE_SLOT, slot_name_in)
+invoke_slot_message_t::invoke_slot_message_t(shared_t<slot_t> slot_in)
+: message_t(&message_name, slot_in)
 {
-    assert(slot_name_in != "");
+    assert(slot_in != nullptr);
 }
 
 shared_t<object_t> object_t::_make(const string_t& type_in, const init_args_t& init_args_in)
@@ -97,6 +97,13 @@ object_t::~object_t()
     if (own_init_args) {
         delete init_args;
     }
+
+#ifdef CONFIG_ENABLE_DBUS
+    if (dbus_object != nullptr) {
+        delete dbus_object;
+        dbus_object = nullptr;
+    }
+#endif
 }
 
 string_t object_t::description()
@@ -128,17 +135,41 @@ void object_t::init()
 
     add_property(JACKALOPE_PROPERTY_OBJECT_TYPE, property_t::type_t::string, init_args);
 
-    add_message_handler<invoke_slot_message_t>([this] (const string_t& slot_name_in) { this->message_invoke_slot(slot_name_in); });
+    add_message_handler<invoke_slot_message_t>([this] (shared_t<slot_t> slot_in) { this->message_invoke_slot(slot_in); });
 
     add_slot(JACKALOPE_SLOT_OBJECT_STOP, std::bind(&object_t::stop, this));
 
     add_signal(JACKALOPE_SIGNAL_OBJECT_STOPPED);
 
-#ifdef CONFIG_HAVE_DBUS
+#ifdef CONFIG_ENABLE_DBUS
     dbus_object = new object_dbus_t(*this, to_string("/Object/", id).c_str());
 #endif
 }
 
+shared_t<async_engine_t> object_t::get_async_engine()
+{
+    return async_engine;
+}
+
+void object_t::set_async_engine(shared_t<async_engine_t> async_engine_in)
+{
+    assert_lockable_owner();
+    assert(async_engine_in != nullptr);
+
+    if (started_flag) {
+        throw_runtime_error("can not change the async engine of an object that has started");
+    }
+
+    async_engine = async_engine_in;
+}
+
+bool object_t::is_started()
+{
+    assert_lockable_owner();
+
+    return started_flag;
+}
+
 bool object_t::is_stopped()
 {
     assert_lockable_owner();
@@ -188,6 +219,26 @@ string_t object_t::peek(const string_t& property_name_in)
     return get_property(property_name_in)->get();
 }
 
+pool_map_t<string_t, real_t> object_t::get_stats()
+{
+    pool_map_t<string_t, real_t> stats;
+
+    for(auto& i : get_properties()) {
+        auto name = i.first.get_name();
+        auto& property = i.second;
+
+        if (name.compare(0, 6, "state.") != 0 || property->type == property_t::type_t::string) {
+            continue;
+        }
+
+        if (property->is_defined()) {
+            stats.emplace(name, property->get_number());
+        }
+    }
+
+    return stats;
+}
+
 void object_t::poke(const string_t& property_name_in, const double value_in)
 {
     assert_lockable_owner();
@@ -202,21 +253,30 @@ void object_t::poke(const string_t& property_name_in, const string_t& value_in)
     get_property(property_name_in)->set(value_in);
 }
 
+void object_t::ramp(const string_t& property_name_in, const ramp_points_t& points_in)
+{
+    assert_lockable_owner();
+
+    get_property(property_name_in)->set_ramp(points_in);
+}
+
 void object_t::subscribe(const string_t& signal_name_in, shared_t<object_t> target_object_in, const string_t& target_slot_name_in)
 {
     assert_lockable_owner();
     assert_object_owner(target_object_in);
 
     auto signal = get_signal(signal_name_in);
-    signal->subscribe(target_object_in, target_slot_name_in);
+    // the slot is found now so sending the signal does not have to
+    // look it up by name every time
+    auto slot = target_object_in->get_slot(target_slot_name_in);
+    signal->subscribe(target_object_in, slot);
 }
 
-void object_t::message_invoke_slot(const string_t slot_name_in)
+void object_t::message_invoke_slot(shared_t<slot_t> slot_in)
 {
     assert_lockable_owner();
 
-    auto slot = get_slot(slot_name_in);
-    slot->invoke();
+    slot_in->invoke();
 }
 
 void object_t::start()
@@ -244,27 +304,83 @@ void object_t::stop()
 
     stopped_flag = true;
 
-    message_queue.empty();
+    {
+        lock_t message_lock(message_mutex);
+        message_queue.clear();
+    }
 
     get_signal(JACKALOPE_SIGNAL_OBJECT_STOPPED)->send();
 }
 
-#ifdef CONFIG_HAVE_DBUS
+#ifdef CONFIG_ENABLE_DBUS
+template <typename T>
+static T dbus_wait_job(object_t& object_in, async_job_t<T> job_in)
+{
+    promise_t<T> promise;
+
+    object_in.get_async_engine()->submit_job([&] {
+        try {
+            promise.set_value(job_in());
+        } catch (...) {
+            promise.set_exception(std::current_exception());
+        }
+    });
+
+    return promise.get_future().get();
+}
+
+static void dbus_wait_job(object_t& object_in, async_job_t<void> job_in)
+{
+    promise_t<void> promise;
+
+    object_in.get_async_engine()->submit_job([&] {
+        try {
+            job_in();
+            promise.set_value();
+        } catch (...) {
+            promise.set_exception(std::current_exception());
+        }
+    });
+
+    promise.get_future().get();
+}
+
+static DBus::Variant property_to_variant(shared_t<property_t> property_in)
+{
+    DBus::Variant variant;
+    DBus::MessageIter iter = variant.writer();
+
+    if (property_in->type == property_t::type_t::string) {
+        iter << std::string(property_in->get_string().c_str());
+    } else {
+        iter << property_in->get_number();
+    }
+
+    return variant;
+}
+
 object_dbus_t::object_dbus_t(object_t& object_in, const char * path_in)
 : DBus::ObjectAdaptor(dbus_get_connection(), path_in), object(object_in)
-{ }
+{
+    dbus_add_object(this);
+}
+
+object_dbus_t::~object_dbus_t()
+{
+    dbus_remove_object(this);
+}
 
 std::map<std::string, std::string> object_dbus_t::get_properties()
 {
     std::map<std::string, std::string> retval;
 
-    auto properties = wait_job<const pool_map_t<string_t, shared_t<property_t>>>([&] {
+    auto properties = dbus_wait_job<const symbol_map_t<shared_t<property_t>>>(object, [&] {
         auto lock = object.get_object_lock();
         return object.get_properties();
     });
 
     for(auto i : properties) {
-        retval.emplace(i.first.c_str(), i.second->get().c_str());
+        retval.emplace(i.first.get_name().c_str(), i.second->get().c_str());
     }
 
     return retval;
@@ -272,7 +388,7 @@ std::map<std::string, std::string> object_dbus_t::get_properties()
 
 std::string object_dbus_t::peek(const std::string& property_name_in)
 {
-    auto result = wait_job<string_t>([&] {
+    auto result = dbus_wait_job<string_t>(object, [&] {
         auto lock = object.get_object_lock();
         return object.get_property(property_name_in.c_str())->get_string();
     });
@@ -282,11 +398,126 @@ std::string object_dbus_t::peek(const std::string& property_name_in)
 
 void object_dbus_t::poke(const std::string& property_name_in, const std::string& value_in)
 {
-    wait_job<void>([&] {
+    dbus_wait_job(object, [&] {
         auto lock = object.get_object_lock();
         object.get_property(property_name_in.c_str())->set(value_in.c_str());
     });
 }
+
+std::map<std::string, DBus::Variant> object_dbus_t::get_values(const std::vector<std::string>& names_in)
+{
+    std::map<std::string, DBus::Variant> values;
+
+    for(auto& i : names_in) {
+        auto property = object.get_property(i.c_str());
+
+        if (property->is_defined()) {
+            values.emplace(i, property_to_variant(property));
+        }
+    }
+
+    return values;
+}
+
+void object_dbus_t::set_values(const std::map<std::string, DBus::Variant>& values_in)
+{
+    // every value is set in one job so the node sees them change
+    // together
+    dbus_wait_job(object, [&] {
+        auto lock = object.get_object_lock();
+
+        for(auto& i : values_in) {
+            auto property = object.get_property(i.first.c_str());
+
+            if (i.second.signature() == "s") {
+                std::string value = i.second;
+                property->set(string_t(value.c_str()));
+            } else if (i.second.signature() == "d") {
+                double value = i.second;
+                property->set(value);
+            } else {
+                throw_runtime_error("unsupported D-Bus type for property ", i.first.c_str(), ": ", i.second.signature().c_str());
+            }
+        }
+    });
+}
+
+std::map<std::string, double> object_dbus_t::get_stats()
+{
+    std::map<std::string, double> stats;
+
+    for(auto& i : object.get_stats()) {
+        stats.emplace(i.first.c_str(), i.second);
+    }
+
+    return stats;
+}
+
+void object_dbus_t::watch(const std::vector<std::string>& names_in)
+{
+    for(auto& i : names_in) {
+        // fail before anything is watched if the name is bad
+        object.get_property(i.c_str());
+    }
+
+    std::unique_lock<std::mutex> lock(watch_mutex);
+
+    for(auto& i : names_in) {
+        watches.emplace(i, watch_t());
+    }
+}
+
+void object_dbus_t::unwatch(const std::vector<std::string>& names_in)
+{
+    std::unique_lock<std::mutex> lock(watch_mutex);
+
+    for(auto& i : names_in) {
+        watches.erase(i);
+    }
+}
+
+void object_dbus_t::notify_changes()
+{
+    std::map<std::string, DBus::Variant> changed;
+
+    {
+        std::unique_lock<std::mutex> lock(watch_mutex);
+
+        for(auto& i : watches) {
+            auto property = object.get_property(i.first.c_str());
+            auto& watch = i.second;
+
+            if (! property->is_defined()) {
+                continue;
+            }
+
+            if (property->type == property_t::type_t::string) {
+                auto value = std::string(property->get_string().c_str());
+
+                if (watch.sent && watch.string == value) {
+                    continue;
+                }
+
+                watch.string = value;
+            } else {
+                double value = property->get_number();
+
+                if (watch.sent && watch.number == value) {
+                    continue;
+                }
+
+                watch.number = value;
+            }
+
+            watch.sent = true;
+            changed.emplace(i.first, property_to_variant(property));
+        }
+    }
+
+    if (changed.size() > 0) {
+        properties_changed(changed);
+    }
+}
 #endif
 
 } //namespace jackalope
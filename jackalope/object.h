@@ -24,7 +24,7 @@
 #include <jackalope/thread.h>
 #include <jackalope/types.h>
 
-#ifdef CONFIG_HAVE_DBUS
+#ifdef CONFIG_ENABLE_DBUS
 #include <jackalope/dbus.h>
 #endif
 
@@ -36,27 +36,49 @@ namespace jackalope {
 #define JACKALOPE_SLOT_OBJECT_STOP                 "object.stop"
 #define JACKALOPE_SIGNAL_OBJECT_STOPPED            "object.stopped"
 
-#define JACKALOPE_OBJECT_LOG_VARGS(level, ...) JACKALOPE_LOG_VARGS(JACKALOPE_LOG_NAME, jackalope::log::level_t::level, "(", this->description(), ") ", __VA_ARGS__)
-#define object_log_info(...) JACKALOPE_OBJECT_LOG_VARGS(info, __VA_ARGS__)
+#define JACKALOPE_OBJECT_LOG_VARGS(level, ...) do { if (this->should_log(jackalope::log::level_t::level)) { JACKALOPE_LOG_VARGS(JACKALOPE_LOG_NAME, jackalope::log::level_t::level, "(", this->description(), ") ", __VA_ARGS__); } } while (0)
+#define object_log_trace(...)   JACKALOPE_OBJECT_LOG_VARGS(trace, __VA_ARGS__)
+#define object_log_debug(...)   JACKALOPE_OBJECT_LOG_VARGS(debug, __VA_ARGS__)
+#define object_log_verbose(...) JACKALOPE_OBJECT_LOG_VARGS(verbose, __VA_ARGS__)
+#define object_log_info(...)    JACKALOPE_OBJECT_LOG_VARGS(info, __VA_ARGS__)
+#define object_log_error(...)   JACKALOPE_OBJECT_LOG_VARGS(error, __VA_ARGS__)
 
 using object_library_t = library_t<object_t, const string_t&, const init_args_t&>;
 
 void add_object_constructor(const string_t& class_name_in, object_library_t::constructor_t constructor_in);
 size_t _get_object_id();
 
-struct invoke_slot_message_t : public message_t<const string_t> {
+struct invoke_slot_message_t : public message_t<shared_t<slot_t>> {
     static const string_t message_name;
-    invoke_slot_message_t(const string_t& slot_name_in);
+    invoke_slot_message_t(shared_t<slot_t> slot_in);
 };
 
-#ifdef CONFIG_HAVE_DBUS
+#ifdef CONFIG_ENABLE_DBUS
 struct object_dbus_t : public object_adaptor, public DBus::IntrospectableAdaptor, public DBus::ObjectAdaptor {
+    struct watch_t {
+        bool sent = false;
+        double number = 0;
+        std::string string;
+    };
+
     object_t& object;
+    std::mutex watch_mutex;
+    std::map<std::string, watch_t> watches;
 
     object_dbus_t(object_t& object_in, const char * path_in);
+    virtual ~object_dbus_t();
     virtual std::map<std::string, std::string> get_properties() override;
     virtual std::string peek(const std::string& property_name_in) override;
     virtual void poke(const std::string& property_name_in, const std::string& value_in) override;
+    // numeric values are read from their atomics so bulk reads do not
+    // wait on the async engine
+    virtual std::map<std::string, DBus::Variant> get_values(const std::vector<std::string>& names_in) override;
+    virtual void set_values(const std::map<std::string, DBus::Variant>& values_in) override;
+    virtual std::map<std::string, double> get_stats() override;
+    virtual void watch(const std::vector<std::string>& names_in) override;
+    virtual void unwatch(const std::vector<std::string>& names_in) override;
+    // called by the D-Bus notify thread
+    void notify_changes();
 };
 #endif
 
@@ -68,7 +90,7 @@ class object_t :
     friend jackalope_object_t;
 
 protected:
-#ifdef CONFIG_HAVE_DBUS
+#ifdef CONFIG_ENABLE_DBUS
     object_dbus_t * dbus_object = nullptr;
 #endif
 
@@ -76,7 +98,11 @@ protected:
     bool started_flag = false;
     bool stopped_flag = false;
     bool own_init_args = false;
-    const shared_t<async_engine_t> async_engine = get_async_engine();
+    // only changed before the object starts, while nothing is sending
+    // it messages
+    shared_t<async_engine_t> async_engine = jackalope::get_async_engine();
+    // events below this level are dropped before the description is built
+    atomic_t<log::level_t> log_level = ATOMIC_VAR_INIT(log::level_t::unknown);
 
     object_t(const string_t& type_in, const init_args_t& init_args_in);
     object_t(const string_t& type_in, const init_args_t * init_args_in);
@@ -86,7 +112,7 @@ protected:
     static shared_t<object_t> _make(const init_args_t& init_args_in);
 
     virtual bool should_deliver() override;
-    virtual void message_invoke_slot(const string_t slot_name_in);
+    virtual void message_invoke_slot(shared_t<slot_t> slot_in);
 
 public:
     const init_args_t * init_args = nullptr;
@@ -101,6 +127,16 @@ public:
 
     virtual string_t description();
 
+    bool should_log(const log::level_t level_in)
+    {
+        return level_in >= log_level.load(std::memory_order_relaxed);
+    }
+
+    void set_log_level(const log::level_t level_in)
+    {
+        log_level.store(level_in, std::memory_order_relaxed);
+    }
+
     void alias_property(const string_t& property_name_in, shared_t<object_t> target_object_in, const string_t& target_property_name_in);
 
     virtual void _send_message(shared_t<abstract_message_t> message_in);
@@ -115,10 +151,17 @@ public:
 
     virtual void subscribe(const string_t& signal_name_in, shared_t<object_t> target_object_in, const string_t& target_slot_name_in);
 
+    shared_t<async_engine_t> get_async_engine();
+    void set_async_engine(shared_t<async_engine_t> async_engine_in);
+    virtual bool is_started();
     virtual bool is_stopped();
     virtual string_t peek(const string_t& property_name_in);
+    // numeric state.* properties and any measurements of the object;
+    // does not need the object lock
+    virtual pool_map_t<string_t, real_t> get_stats();
     virtual void poke(const string_t& property_name_in, const double value_in);
     virtual void poke(const string_t& property_name_in, const string_t& value_in);
+    virtual void ramp(const string_t& property_name_in, const ramp_points_t& points_in);
     virtual void init();
     virtual void start();
     virtual void stop();
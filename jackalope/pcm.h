@@ -13,6 +13,10 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
 #include <jackalope/property.h>
 #include <jackalope/types.h>
 
@@ -33,6 +37,15 @@ inline real_t pcm_db_scale_factor(const real_t db_in)
     return pow(10.0f, db_in / 20.0f);
 }
 
+// convert a buffer of gain values in dB to scale factors in place
+template <typename T>
+void pcm_db_scale_factor(T * pcm_in, const size_t num_samples_in)
+{
+    for(size_t i = 0; i < num_samples_in; i++) {
+        pcm_in[i] = pcm_db_scale_factor(pcm_in[i]);
+    }
+}
+
 template <typename T>
 void pcm_copy(const T * source_in, T * dest_in, const size_t num_samples_in)
 {
@@ -49,6 +62,23 @@ void pcm_zero(T * pcm_in, const size_t num_samples_in)
     }
 }
 
+template <typename T>
+void pcm_set(T * pcm_in, const T value_in, const size_t num_samples_in)
+{
+    for(size_t i = 0; i < num_samples_in; i++) {
+        pcm_in[i] = value_in;
+    }
+}
+
+// fill with start_in, start_in + step_in, start_in + 2 * step_in, ...
+template <typename T>
+void pcm_ramp(T * pcm_in, const T start_in, const T step_in, const size_t num_samples_in)
+{
+    for(size_t i = 0; i < num_samples_in; i++) {
+        pcm_in[i] = start_in + step_in * i;
+    }
+}
+
 template <typename T>
 void pcm_multiply(T * pcm_in, T value_in, const size_t num_samples_in)
 {
@@ -57,6 +87,58 @@ void pcm_multiply(T * pcm_in, T value_in, const size_t num_samples_in)
     }
 }
 
+template <typename T>
+void pcm_multiply(T * pcm_in, const T * values_in, const size_t num_samples_in)
+{
+    for(size_t i = 0; i < num_samples_in; i++) {
+        pcm_in[i] = pcm_in[i] * values_in[i];
+    }
+}
+
+// dest_in += source_in
+template <typename T>
+void pcm_add(const T * source_in, T * dest_in, const size_t num_samples_in)
+{
+    for(size_t i = 0; i < num_samples_in; i++) {
+        dest_in[i] += source_in[i];
+    }
+}
+
+// dest_in += source_in * value_in
+template <typename T>
+void pcm_multiply_add(const T * source_in, T * dest_in, const T value_in, const size_t num_samples_in)
+{
+    for(size_t i = 0; i < num_samples_in; i++) {
+        dest_in[i] += source_in[i] * value_in;
+    }
+}
+
+template <typename T>
+T pcm_dot(const T * left_in, const T * right_in, const size_t num_samples_in)
+{
+    T sum = 0;
+
+    for(size_t i = 0; i < num_samples_in; i++) {
+        sum += left_in[i] * right_in[i];
+    }
+
+    return sum;
+}
+
+// largest absolute sample value
+template <typename T>
+T pcm_peak(const T * pcm_in, const size_t num_samples_in)
+{
+    T peak = 0;
+
+    for(size_t i = 0; i < num_samples_in; i++) {
+        auto value = std::fabs(pcm_in[i]);
+        peak = value > peak ? value : peak;
+    }
+
+    return peak;
+}
+
 template <typename T>
 void pcm_extract_interleave(const T * source_in, T * dest_in, const size_t extract_channel_in, const size_t num_channels_in, const size_t num_samples_in)
 {
@@ -75,4 +157,84 @@ void pcm_insert_interleave(const T * source_in, T * dest_in, const size_t interl
     }
 }
 
+// first in first out queue of samples; the storage only grows when
+// more samples are queued than it has ever held before
+template <typename T>
+class pcm_ring_t : public base_t {
+
+protected:
+    pool_vector_t<T> storage;
+    size_t read_position = 0;
+    size_t num_queued = 0;
+
+    void grow(const size_t capacity_in)
+    {
+        pool_vector_t<T> new_storage(capacity_in);
+        read(new_storage.data(), num_queued, false);
+        storage.swap(new_storage);
+        read_position = 0;
+    }
+
+    void read(T * dest_in, const size_t num_samples_in, const bool consume_in)
+    {
+        auto position = read_position;
+
+        for(size_t i = 0; i < num_samples_in; i++) {
+            dest_in[i] = storage[position];
+            position = position + 1 == storage.size() ? 0 : position + 1;
+        }
+
+        if (consume_in) {
+            read_position = position;
+            num_queued -= num_samples_in;
+        }
+    }
+
+public:
+    size_t size()
+    {
+        return num_queued;
+    }
+
+    void clear()
+    {
+        read_position = 0;
+        num_queued = 0;
+    }
+
+    void reserve(const size_t capacity_in)
+    {
+        if (capacity_in > storage.size()) {
+            grow(capacity_in);
+        }
+    }
+
+    void write(const T * source_in, const size_t num_samples_in)
+    {
+        if (num_samples_in == 0) {
+            return;
+        }
+
+        if (num_queued + num_samples_in > storage.size()) {
+            grow(std::max(storage.size() * 2, num_queued + num_samples_in));
+        }
+
+        auto position = (read_position + num_queued) % storage.size();
+
+        for(size_t i = 0; i < num_samples_in; i++) {
+            storage[position] = source_in[i];
+            position = position + 1 == storage.size() ? 0 : position + 1;
+        }
+
+        num_queued += num_samples_in;
+    }
+
+    void read(T * dest_in, const size_t num_samples_in)
+    {
+        assert(num_samples_in <= num_queued);
+
+        read(dest_in, num_samples_in, true);
+    }
+};
+
 } // namespace jackalope
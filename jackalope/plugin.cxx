@@ -11,7 +11,11 @@
 // MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
 // GNU Lesser General Public License for more details.
 
+#include <jackalope/audio.h>
+#include <jackalope/midi.h>
+#include <jackalope/pcm.h>
 #include <jackalope/plugin.h>
+#include <jackalope/string.h>
 
 namespace jackalope {
 
@@ -19,20 +23,61 @@ plugin_t::plugin_t(const init_args_t init_args_in)
 : node_t(init_args_in)
 { }
 
+void plugin_t::bind_property(const string_t& sink_name_in, const string_t& property_name_in)
+{
+    assert_lockable_owner();
+
+    if (started_flag) {
+        throw_runtime_error("can not bind a property after the node is started: ", property_name_in);
+    }
+
+    auto sink = add_sink(sink_name_in, JACKALOPE_TYPE_CONTROL);
+    control_bindings.push_back({ dynamic_pointer_cast<control_sink_t>(sink), property_name_in });
+}
+
+void plugin_t::activate()
+{
+    assert_lockable_owner();
+
+    node_t::activate();
+
+    for (auto& i : init_args_find(JACKALOPE_CONTROL_ARG_BIND, init_args)) {
+        auto parts = split_string(i.first, '.');
+
+        if (parts.size() != 2) {
+            throw_runtime_error("invalid property binding argument: ", i.first);
+        }
+
+        bind_property(parts.at(1), i.second);
+    }
+}
+
 void plugin_t::start()
 {
     assert_lockable_owner();
 
+    // properties can be added while a node activates so bindings
+    // are resolved once the node is complete
+    for (auto& i : control_bindings) {
+        auto property = get_property(i.property_name);
+
+        if (property->type == property_t::type_t::string) {
+            throw_runtime_error("can not bind a control sink to a string property: ", i.property_name);
+        }
+
+        i.property = property;
+    }
+
     node_t::start();
 
     execute_if_needed();
 }
 
-void plugin_t::message_invoke_slot(const string_t slot_name_in)
+void plugin_t::message_invoke_slot(shared_t<slot_t> slot_in)
 {
     assert_lockable_owner();
 
-    node_t::message_invoke_slot(slot_name_in);
+    node_t::message_invoke_slot(slot_in);
 
     execute_if_needed();
 }
@@ -68,11 +113,26 @@ void plugin_t::execute_if_needed()
             break;
         }
 
-        object_log_info("plugin will now execute");
+        object_log_trace("plugin will now execute");
+        apply_control_bindings();
         execute();
     }
 }
 
+void plugin_t::apply_control_bindings()
+{
+    assert_lockable_owner();
+
+    for (auto& i : control_bindings) {
+        if (! i.sink->has_links()) {
+            continue;
+        }
+
+        i.property->set(i.sink->get_value());
+        i.sink->reset();
+    }
+}
+
 driver_t::driver_t(const init_args_t init_args_in)
 : plugin_t(init_args_in)
 { }
@@ -90,6 +150,79 @@ bool driver_t::should_execute()
     return true;
 }
 
+bool driver_t::sources_available()
+{
+    assert_lockable_owner();
+
+    for (auto i : sources) {
+        if (! i->is_available()) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool driver_t::warm_up_push()
+{
+    assert_lockable_owner();
+
+    if (started_flag) {
+        throw_runtime_error("can not warm up a driver that has started");
+    }
+
+    if (! sources_available()) {
+        return false;
+    }
+
+    size_t buffer_size = 0;
+
+    if (has_property(JACKALOPE_PROPERTY_PCM_BUFFER_SIZE) && get_property(JACKALOPE_PROPERTY_PCM_BUFFER_SIZE)->is_defined()) {
+        buffer_size = get_property(JACKALOPE_PROPERTY_PCM_BUFFER_SIZE)->get_size();
+    }
+
+    for (auto i : sources) {
+        if (buffer_size == 0 && i->type != JACKALOPE_TYPE_CONTROL) {
+            throw_runtime_error("can not warm up a driver with out a buffer size: ", name);
+        }
+
+        if (i->type == JACKALOPE_TYPE_AUDIO) {
+            // the new buffer is already silent
+            dynamic_pointer_cast<audio_source_t>(i)->notify_buffer(jackalope::make_shared<audio_buffer_t>(buffer_size));
+        } else if (i->type == JACKALOPE_TYPE_MIDI) {
+            dynamic_pointer_cast<midi_source_t>(i)->notify_buffer(jackalope::make_shared<midi_buffer_t>(buffer_size));
+        } else if (i->type == JACKALOPE_TYPE_CONTROL) {
+            dynamic_pointer_cast<control_source_t>(i)->notify_value(0);
+        }
+    }
+
+    return true;
+}
+
+bool driver_t::warm_up_pull()
+{
+    assert_lockable_owner();
+
+    if (started_flag) {
+        throw_runtime_error("can not warm up a driver that has started");
+    }
+
+    if (! driver_t::should_execute()) {
+        return false;
+    }
+
+    for (auto i : sinks) {
+        // mixes the links the same way a real period does
+        if (i->type == JACKALOPE_TYPE_AUDIO) {
+            dynamic_pointer_cast<audio_sink_t>(i)->get_buffer();
+        }
+
+        i->reset();
+    }
+
+    return true;
+}
+
 threaded_driver_t::threaded_driver_t(const init_args_t init_args_in)
 : driver_t(init_args_in)
 { }
@@ -133,6 +266,12 @@ bool filter_plugin_t::should_execute()
 {
     assert_lockable_owner();
 
+    // with every link removed the node would be available and
+    // ready forever
+    if (! has_links()) {
+        return false;
+    }
+
     for (auto i : sources) {
         if (! i->is_available()) {
             return false;
@@ -13,23 +13,39 @@
 
 #pragma once
 
+#include <jackalope/control.h>
 #include <jackalope/node.h>
+#include <jackalope/thread.h>
 #include <jackalope/types.h>
 
+// how long a warm up block may take to make it through the graph
+#define JACKALOPE_DRIVER_WARM_UP_TIMEOUT_MS 1000
+
 namespace jackalope {
 
+struct control_binding_t {
+    shared_t<control_sink_t> sink;
+    string_t property_name;
+    shared_t<property_t> property = nullptr;
+};
+
 class plugin_t : public node_t {
 
 protected:
+    pool_vector_t<control_binding_t> control_bindings;
+
     plugin_t(const init_args_t init_args_in);
+    virtual void apply_control_bindings();
     virtual bool should_execute() = 0;
     virtual void execute_if_needed();
     virtual void execute() = 0;
-    virtual void message_invoke_slot(const string_t slot_name_in) override;
+    virtual void message_invoke_slot(shared_t<slot_t> slot_in) override;
     virtual void sink_ready(shared_t<sink_t> sink_in) override;
     virtual void source_available(shared_t<source_t> source_in) override;
 
 public:
+    virtual void bind_property(const string_t& sink_name_in, const string_t& property_name_in);
+    virtual void activate() override;
     virtual void start() override;
 };
 
@@ -38,6 +54,15 @@ class driver_t : public plugin_t {
 protected:
     driver_t(const init_args_t init_args_in);
     bool should_execute() override;
+    virtual bool sources_available();
+
+public:
+    // a driver that has not started yet can run silent blocks through
+    // the graph: push gives every source a block and pull takes one
+    // from every sink; both return false with out waiting if the graph
+    // is not ready for that yet
+    virtual bool warm_up_push();
+    virtual bool warm_up_pull();
 };
 
 class threaded_driver_t : public driver_t {
@@ -23,38 +23,77 @@ property_t::property_t(const type_t type_in)
 {
     switch(type) {
         case type_t::unknown: throw_runtime_error("can not specify unknown as a property type");
-        case type_t::size: value.size = 0; break;
-        case type_t::integer: value.integer = 0; break;
-        case type_t::real: value.real = 0; break;
-        case type_t::string: value.string = new string_t; break;
+        case type_t::size: break;
+        case type_t::integer: break;
+        case type_t::real: break;
+        case type_t::string: string_value = new string_t; break;
     }
 }
 
 property_t::~property_t()
 {
-    if (type == type_t::string && value.string != nullptr) {
-        delete(value.string);
-        value.string = nullptr;
+    if (string_value != nullptr) {
+        delete(string_value);
+        string_value = nullptr;
     }
 }
 
-bool property_t::is_defined()
+void property_t::check_type(const type_t type_in)
 {
-    auto lock = get_object_lock();
+    if (type == type_in) {
+        return;
+    }
+
+    switch(type_in) {
+        case type_t::unknown: throw_runtime_error("property type was not known");
+        case type_t::size: throw_runtime_error("property is not of type: size");
+        case type_t::integer: throw_runtime_error("property is not of type: integer");
+        case type_t::real: throw_runtime_error("property is not of type: real");
+        case type_t::string: throw_runtime_error("property is not of type: string");
+    }
 
-    return defined_flag;
+    throw_runtime_error("should never get out of switch statement");
+}
+
+void property_t::check_defined()
+{
+    if (! defined_flag.load(std::memory_order_acquire)) {
+        throw_runtime_error("Use of undefined property");
+    }
+}
+
+bool property_t::is_defined()
+{
+    return defined_flag.load(std::memory_order_acquire);
 }
 
 string_t property_t::get()
 {
-    auto lock = get_object_lock();
+    switch(type) {
+        case type_t::unknown: throw_runtime_error("property type was not known");
+        case type_t::size: return to_string(size_value.load(std::memory_order_relaxed));
+        case type_t::integer: return to_string(integer_value.load(std::memory_order_relaxed));
+        case type_t::real: return to_string(real_value.load(std::memory_order_relaxed));
+        case type_t::string: {
+            auto lock = get_object_lock();
+            return *string_value;
+        }
+    }
+
+    throw_runtime_error("should never get out of switch statement");
+}
+
+// reads any numeric type with out converting through a string
+double property_t::get_number()
+{
+    check_defined();
 
     switch(type) {
         case type_t::unknown: throw_runtime_error("property type was not known");
-        case type_t::size: return to_string(value.size);
-        case type_t::integer: return to_string(value.integer);
-        case type_t::real: return to_string(value.real);
-        case type_t::string: return *value.string;
+        case type_t::size: return size_value.load(std::memory_order_relaxed);
+        case type_t::integer: return integer_value.load(std::memory_order_relaxed);
+        case type_t::real: return real_value.load(std::memory_order_relaxed);
+        case type_t::string: throw_runtime_error("string property does not have a number");
     }
 
     throw_runtime_error("should never get out of switch statement");
@@ -90,112 +129,86 @@ void property_t::set(const string_t& value_in)
     throw_runtime_error("should never get out of switch statement");
 }
 
-size_t& property_t::get_size()
+// the numeric accessors do not lock and are safe to call from
+// a realtime thread
+size_t property_t::get_size()
 {
-    auto lock = get_object_lock();
+    check_type(type_t::size);
+    check_defined();
 
-    if (! defined_flag) {
-        throw_runtime_error("Use of undefined property");
-    }
-
-    if (type != type_t::size) {
-        throw_runtime_error("property is not of type: size");
-    }
-
-    return value.size;
+    return size_value.load(std::memory_order_relaxed);
 }
 
 void property_t::set_size(const size_t size_in)
 {
-    auto lock = get_object_lock();
+    check_type(type_t::size);
 
-    if (type != type_t::size) {
-        throw_runtime_error("property is not of type: size");
-    }
-
-    defined_flag = true;
-    value.size = size_in;
+    size_value.store(size_in, std::memory_order_relaxed);
+    defined_flag.store(true, std::memory_order_release);
 }
 
-int_t& property_t::get_integer()
+int_t property_t::get_integer()
 {
-    auto lock = get_object_lock();
-
-    if (! defined_flag) {
-        throw_runtime_error("Use of undefined property");
-    }
-
-    if (type != type_t::integer) {
-        throw_runtime_error("property is not of type: integer");
-    }
+    check_type(type_t::integer);
+    check_defined();
 
-    return value.integer;
+    return integer_value.load(std::memory_order_relaxed);
 }
 
 void property_t::set_integer(const int_t integer_in)
 {
-    auto lock = get_object_lock();
-
-    if (type != type_t::integer) {
-        throw_runtime_error("property is not of type: integer");
-    }
+    check_type(type_t::integer);
 
-    defined_flag = true;
-    value.integer = integer_in;
+    integer_value.store(integer_in, std::memory_order_relaxed);
+    defined_flag.store(true, std::memory_order_release);
 }
 
 void property_t::set_real(const real_t real_in)
 {
-    auto lock = get_object_lock();
+    check_type(type_t::real);
 
-    if (type != type_t::real) {
-        throw_runtime_error("property is not of type: real");
-    }
-
-    defined_flag = true;
-    value.real = real_in;
+    real_value.store(real_in, std::memory_order_relaxed);
+    defined_flag.store(true, std::memory_order_release);
 }
 
-real_t& property_t::get_real()
+// the value of the property becomes the final point and the owning
+// node follows the points to get there
+void property_t::set_ramp(const ramp_points_t& points_in)
 {
-    auto lock = get_object_lock();
+    check_type(type_t::real);
 
-    if (! defined_flag) {
-        throw_runtime_error("Use of undefined property");
-    }
-
-    if (type != type_t::real) {
-        throw_runtime_error("property is not of type: real");
+    if (points_in.size() == 0) {
+        throw_runtime_error("ramp must have at least one point");
     }
 
-    return value.real;
+    ramp.set_points(points_in);
+    set_real(points_in.back().value);
 }
 
-void property_t::set_string(const string_t& string_in)
+real_t property_t::get_real()
 {
-    auto lock = get_object_lock();
+    check_type(type_t::real);
+    check_defined();
 
-    if (type != type_t::string) {
-        throw_runtime_error("property is not of type: string");
-    }
-
-    defined_flag = true;
-    *value.string = string_in;
+    return real_value.load(std::memory_order_relaxed);
 }
 
-string_t& property_t::get_string()
+void property_t::set_string(const string_t& string_in)
 {
-    auto lock = get_object_lock();
+    check_type(type_t::string);
 
-    if (! defined_flag) {
-        throw_runtime_error("Use of undefined property");
-    }
+    auto lock = get_object_lock();
+    *string_value = string_in;
+    defined_flag.store(true, std::memory_order_release);
+}
 
-    if (type != type_t::string) {
-        throw_runtime_error("property is not of type: string");
-    }
+string_t property_t::get_string()
+{
+    check_type(type_t::string);
+    check_defined();
 
-    return *value.string;
+    auto lock = get_object_lock();
+    return *string_value;
 }
 
 lock_t prop_obj_t::get_property_lock()
@@ -203,7 +216,7 @@ lock_t prop_obj_t::get_property_lock()
     return lock_t(property_mutex);
 }
 
-shared_t<property_t> prop_obj_t::_add_property(const string_t& name_in, shared_t<property_t> property_in)
+shared_t<property_t> prop_obj_t::_add_property(const symbol_t& name_in, shared_t<property_t> property_in)
 {
     assert_mutex_owner(property_mutex);
 
@@ -217,18 +230,19 @@ shared_t<property_t> prop_obj_t::_add_property(const string_t& name_in, shared_t
 shared_t<property_t> prop_obj_t::add_property(const string_t& name_in, shared_t<property_t> property_in)
 {
     auto lock = get_property_lock();
-    return _add_property(name_in, property_in);
+    return _add_property(symbol_t(name_in), property_in);
 }
 
 shared_t<property_t> prop_obj_t::add_property(const string_t& name_in, property_t::type_t type_in, const init_args_t * init_args_in)
 {
     auto lock = get_property_lock();
+    auto symbol = symbol_t(name_in);
 
     shared_t<property_t> property;
     bool add_needed = false;
 
-    if (_has_property(name_in)) {
-        property = _get_property(name_in);
+    if (_has_property(symbol)) {
+        property = _get_property(symbol);
 
         if (property->type != type_in) {
             throw_runtime_error("can not add a property to a node with an existing property of the same name unless types match");
@@ -245,7 +259,7 @@ shared_t<property_t> prop_obj_t::add_property(const string_t& name_in, property_
     }
 
     if (add_needed) {
-        return _add_property(name_in, property);
+        return _add_property(symbol, property);
     }
 
     return property;
@@ -254,12 +268,13 @@ shared_t<property_t> prop_obj_t::add_property(const string_t& name_in, property_
 shared_t<property_t> prop_obj_t::add_property(const string_t& name_in, property_t::type_t type_in)
 {
     auto lock = get_property_lock();
+    auto symbol = symbol_t(name_in);
 
     shared_t<property_t> property;
     bool add_needed = false;
 
-    if (_has_property(name_in)) {
-        property = _get_property(name_in);
+    if (_has_property(symbol)) {
+        property = _get_property(symbol);
 
         if (property->type != type_in) {
             throw_runtime_error("can not add a property to a node with an existing property of the same name unless types match");
@@ -270,20 +285,25 @@ shared_t<property_t> prop_obj_t::add_property(const string_t& name_in, property_
     }
 
     if (add_needed) {
-        return _add_property(name_in, property);
+        return _add_property(symbol, property);
     }
 
     return property;
 }
 
 bool prop_obj_t::has_property(const string_t& name_in)
+{
+    return has_property(symbol_t::find(name_in));
+}
+
+bool prop_obj_t::has_property(const symbol_t& name_in)
 {
     auto lock = get_property_lock();
 
     return _has_property(name_in);
 }
 
-bool prop_obj_t::_has_property(const string_t& name_in)
+bool prop_obj_t::_has_property(const symbol_t& name_in)
 {
     assert_mutex_owner(property_mutex);
 
@@ -291,12 +311,23 @@ bool prop_obj_t::_has_property(const string_t& name_in)
 }
 
 shared_t<property_t> prop_obj_t::get_property(const string_t& name_in)
+{
+    auto symbol = symbol_t::find(name_in);
+
+    if (! symbol.is_valid()) {
+        throw_runtime_error("Could not find property: ", name_in);
+    }
+
+    return get_property(symbol);
+}
+
+shared_t<property_t> prop_obj_t::get_property(const symbol_t& name_in)
 {
     auto lock = get_property_lock();
     return _get_property(name_in);
 }
 
-shared_t<property_t> prop_obj_t::_get_property(const string_t& name_in)
+shared_t<property_t> prop_obj_t::_get_property(const symbol_t& name_in)
 {
     assert_mutex_owner(property_mutex);
 
@@ -309,7 +340,7 @@ shared_t<property_t> prop_obj_t::_get_property(const string_t& name_in)
     return found->second;
 }
 
-const pool_map_t<string_t, shared_t<property_t>>& prop_obj_t::get_properties()
+symbol_map_t<shared_t<property_t>> prop_obj_t::get_properties()
 {
     auto lock = get_property_lock();
     return properties;
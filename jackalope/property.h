@@ -13,7 +13,9 @@
 
 #pragma once
 
+#include <jackalope/ramp.h>
 #include <jackalope/string.h>
+#include <jackalope/symbol.h>
 #include <jackalope/thread.h>
 #include <jackalope/types.h>
 
@@ -25,18 +27,23 @@ public:
     enum class type_t { unknown, size, integer, real, string };
 
 protected:
-    union container_t {
-        size_t size;
-        int_t integer;
-        real_t real;
-        string_t * string;
-    };
-
-    container_t value;
-    bool defined_flag = false;
+    // numeric values are atomic so the realtime threads can read them
+    // and control threads can write them with out taking the lock; the
+    // lock only protects the string value
+    atomic_t<size_t> size_value = ATOMIC_VAR_INIT(0);
+    atomic_t<int_t> integer_value = ATOMIC_VAR_INIT(0);
+    atomic_t<real_t> real_value = ATOMIC_VAR_INIT(0);
+    string_t * string_value = nullptr;
+    atomic_t<bool> defined_flag = ATOMIC_VAR_INIT(false);
+
+    void check_type(const type_t type_in);
+    void check_defined();
 
 public:
     const type_t type = type_t::unknown;
+    // consumed by the node that owns a real property so changes to
+    // the value are applied smoothly
+    ramp_t ramp;
 
     template <typename... Args>
     static shared_t<property_t> make(Args... args)
@@ -51,26 +58,28 @@ public:
 
     bool is_defined();
     string_t get();
+    double get_number();
     void set(const double value_in);
     void set(const string_t& value_in);
-    size_t& get_size();
+    size_t get_size();
     void set_size(const size_t size_in);
-    int_t& get_integer();
+    int_t get_integer();
     void set_integer(const int_t integer_in);
     void set_real(const real_t real_in);
-    real_t& get_real();
-    string_t& get_string();
+    void set_ramp(const ramp_points_t& points_in);
+    real_t get_real();
+    string_t get_string();
     void set_string(const string_t& string_in);
 };
 
 class prop_obj_t {
 
-    pool_map_t<string_t, shared_t<property_t>> properties;
+    symbol_map_t<shared_t<property_t>> properties;
     mutex_t property_mutex;
     virtual lock_t get_property_lock();
-    virtual shared_t<property_t> _add_property(const string_t& name_in, shared_t<property_t> property_in);
-    virtual shared_t<property_t> _get_property(const string_t& name_in);
-    virtual bool _has_property(const string_t& name_in);
+    virtual shared_t<property_t> _add_property(const symbol_t& name_in, shared_t<property_t> property_in);
+    virtual shared_t<property_t> _get_property(const symbol_t& name_in);
+    virtual bool _has_property(const symbol_t& name_in);
 
 protected:
     virtual shared_t<property_t> add_property(const string_t& name_in, shared_t<property_t> property_in);
@@ -79,8 +88,14 @@ protected:
 
 public:
     virtual bool has_property(const string_t& name_in);
+    virtual bool has_property(const symbol_t& name_in);
     virtual shared_t<property_t> get_property(const string_t& name_in);
-    virtual const pool_map_t<string_t, shared_t<property_t>>& get_properties();
+    // resolve the name once with symbol_t and keep the symbol or the
+    // returned property to avoid the string lookup
+    virtual shared_t<property_t> get_property(const symbol_t& name_in);
+    // a copy made under the property lock so it can be walked while
+    // other threads add properties
+    virtual symbol_map_t<shared_t<property_t>> get_properties();
 };
 
 } // namespace jackalope
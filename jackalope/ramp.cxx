@@ -0,0 +1,149 @@
+// Jackalope Audio Engine
+// Copyright 2019 Tyler Riddle <kg7oem@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+
+#include <algorithm>
+#include <cmath>
+
+#include <jackalope/pcm.h>
+#include <jackalope/ramp.h>
+
+namespace jackalope {
+
+void ramp_t::set_points(const ramp_points_t& points_in)
+{
+    auto lock = get_object_lock();
+
+    pending = points_in;
+    pending_flag.store(true, std::memory_order_release);
+}
+
+void ramp_t::reset(const real_t value_in)
+{
+    current = end = value_in;
+    step = 0;
+    remaining = 0;
+    next_point = points.size();
+    initialized_flag = true;
+}
+
+real_t ramp_t::get_current()
+{
+    return current;
+}
+
+// if the lock is busy the new points are picked up on the next call
+void ramp_t::update(const real_t target_in)
+{
+    if (! initialized_flag) {
+        reset(target_in);
+    }
+
+    if (! pending_flag.load(std::memory_order_acquire)) {
+        return;
+    }
+
+    lock_t lock(object_mutex, std::try_to_lock);
+
+    if (! lock.owns_lock()) {
+        return;
+    }
+
+    points.swap(pending);
+    pending.clear();
+    next_point = 0;
+    remaining = 0;
+    pending_flag.store(false, std::memory_order_relaxed);
+}
+
+bool ramp_t::is_steady(const real_t target_in)
+{
+    update(target_in);
+
+    return remaining == 0 && next_point >= points.size() && current == target_in;
+}
+
+bool ramp_t::plan_segment(const size_t sample_rate_in, const real_t target_in)
+{
+    while (next_point < points.size()) {
+        auto& point = points[next_point++];
+        size_t num_samples = std::lround(std::max(point.seconds, 0.0f) * sample_rate_in);
+
+        if (num_samples == 0) {
+            current = end = point.value;
+            continue;
+        }
+
+        end = point.value;
+        step = (end - current) / num_samples;
+        remaining = num_samples;
+
+        return true;
+    }
+
+    if (current == target_in) {
+        return false;
+    }
+
+    size_t num_samples = std::lround(smoothing_seconds * sample_rate_in);
+
+    if (num_samples == 0) {
+        current = end = target_in;
+        return false;
+    }
+
+    end = target_in;
+    step = (end - current) / num_samples;
+    remaining = num_samples;
+
+    return true;
+}
+
+void ramp_t::fill(real_t * values_in, const size_t num_samples_in, const size_t sample_rate_in, const real_t target_in)
+{
+    update(target_in);
+
+    size_t done = 0;
+
+    while (done < num_samples_in) {
+        if (remaining == 0 && ! plan_segment(sample_rate_in, target_in)) {
+            if (values_in != nullptr) {
+                pcm_set(values_in + done, current, num_samples_in - done);
+            }
+
+            return;
+        }
+
+        auto count = std::min(remaining, num_samples_in - done);
+
+        if (values_in != nullptr) {
+            pcm_ramp(values_in + done, current + step, step, count);
+        }
+
+        remaining -= count;
+        done += count;
+
+        if (remaining == 0) {
+            current = end;
+        } else {
+            current += step * count;
+        }
+    }
+}
+
+real_t ramp_t::advance(const size_t num_samples_in, const size_t sample_rate_in, const real_t target_in)
+{
+    fill(nullptr, num_samples_in, sample_rate_in, target_in);
+    return current;
+}
+
+} // namespace jackalope
@@ -0,0 +1,64 @@
+// Jackalope Audio Engine
+// Copyright 2019 Tyler Riddle <kg7oem@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+
+#pragma once
+
+#include <jackalope/string.h>
+#include <jackalope/thread.h>
+#include <jackalope/types.h>
+
+// how long a ramp takes to reach a new value that was set with
+// out an automation ramp
+#define JACKALOPE_RAMP_SMOOTHING_SECONDS 0.01f
+
+namespace jackalope {
+
+struct ramp_point_t {
+    real_t value = 0;
+    // time to move from the previous point to this value
+    real_t seconds = 0;
+};
+
+using ramp_points_t = pool_vector_t<ramp_point_t>;
+
+// new points are handed over from any thread with set_points(); the
+// rest of the methods are for the single thread that consumes the
+// ramp and will not block it
+class ramp_t : public base_t, protected lockable_t {
+
+protected:
+    atomic_t<bool> pending_flag = ATOMIC_VAR_INIT(false);
+    ramp_points_t pending;
+    ramp_points_t points;
+    size_t next_point = 0;
+    bool initialized_flag = false;
+    real_t current = 0;
+    real_t end = 0;
+    real_t step = 0;
+    size_t remaining = 0;
+
+    void update(const real_t target_in);
+    bool plan_segment(const size_t sample_rate_in, const real_t target_in);
+
+public:
+    real_t smoothing_seconds = JACKALOPE_RAMP_SMOOTHING_SECONDS;
+
+    void set_points(const ramp_points_t& points_in);
+    void reset(const real_t value_in);
+    bool is_steady(const real_t target_in);
+    real_t get_current();
+    real_t advance(const size_t num_samples_in, const size_t sample_rate_in, const real_t target_in);
+    void fill(real_t * values_in, const size_t num_samples_in, const size_t sample_rate_in, const real_t target_in);
+};
+
+} // namespace jackalope
@@ -0,0 +1,238 @@
+// Jackalope Audio Engine
+// Copyright 2019 Tyler Riddle <kg7oem@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+
+
+#include <chrono>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <jackalope/node.h>
+#include <jackalope/shm.h>
+
+namespace jackalope {
+
+shm_segment_t::shm_segment_t(const string_t& name_in, const size_t max_slots_in)
+: name(name_in)
+{
+    if (max_slots_in == 0) {
+        throw_runtime_error("shared memory segment needs at least one slot: ", name);
+    }
+
+    size = sizeof(shm_header_t) + sizeof(shm_slot_t) * max_slots_in;
+
+    auto fd = shm_open(name.c_str(), O_CREAT | O_RDWR | O_TRUNC, 0600);
+
+    if (fd == -1) {
+        throw_runtime_error("could not open shared memory segment ", name, ": ", std::strerror(errno));
+    }
+
+    if (ftruncate(fd, size) == -1) {
+        auto error = errno;
+        close(fd);
+        shm_unlink(name.c_str());
+        throw_runtime_error("could not size shared memory segment ", name, ": ", std::strerror(error));
+    }
+
+    auto memory = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+
+    if (memory == MAP_FAILED) {
+        shm_unlink(name.c_str());
+        throw_runtime_error("could not map shared memory segment ", name, ": ", std::strerror(errno));
+    }
+
+    // the memory is zero filled so only the values that are not zero
+    // need to be set; the atomics are lock free so they work when
+    // placed in shared memory
+    header = new (memory) shm_header_t();
+    slots = reinterpret_cast<shm_slot_t *>(header + 1);
+
+    for(size_t i = 0; i < max_slots_in; i++) {
+        new (&slots[i]) shm_slot_t();
+    }
+
+    header->magic = JACKALOPE_SHM_MAGIC;
+    header->version = JACKALOPE_SHM_VERSION;
+    header->slot_size = sizeof(shm_slot_t);
+    header->max_slots = max_slots_in;
+}
+
+shm_segment_t::~shm_segment_t()
+{
+    stop();
+
+    if (header != nullptr) {
+        munmap(header, size);
+        shm_unlink(name.c_str());
+
+        header = nullptr;
+        slots = nullptr;
+    }
+}
+
+// the new table is checked before the header is touched so a table
+// that does not fit leaves the old one in place for readers
+void shm_segment_t::rebuild(const pool_vector_t<shared_t<node_t>>& nodes_in)
+{
+    struct entry_t {
+        shared_t<node_t> node;
+        string_t name;
+        bool is_property;
+        bool writable;
+    };
+
+    pool_vector_t<entry_t> entries;
+
+    for(auto& node : nodes_in) {
+        for(auto& i : node->get_properties()) {
+            auto property_name = i.first.get_name();
+
+            if (i.second->type == property_t::type_t::string) {
+                continue;
+            }
+
+            entries.push_back({ node, property_name, true, property_name.compare(0, 7, "config.") == 0 });
+        }
+
+        for(auto& i : node->get_stats()) {
+            if (! node->has_property(i.first)) {
+                entries.push_back({ node, i.first, false, false });
+            }
+        }
+    }
+
+    std::unique_lock<std::mutex> lock(mutex);
+
+    if (entries.size() > header->max_slots) {
+        throw_runtime_error("shared memory segment ", name, " is out of slots: ", entries.size(), " > ", header->max_slots);
+    }
+
+    for(auto& entry : entries) {
+        if (entry.node->name.size() + 1 + entry.name.size() >= JACKALOPE_SHM_NAME_SIZE) {
+            throw_runtime_error("name is too long for a shared memory slot: ", entry.node->name, "/", entry.name);
+        }
+    }
+
+    header->table_version.fetch_add(1, std::memory_order_acq_rel);
+
+    bindings.clear();
+
+    for(auto& entry : entries) {
+        auto slot_name = to_string(entry.node->name, "/", entry.name);
+        auto& slot = slots[bindings.size()];
+
+        std::memset(slot.name, 0, JACKALOPE_SHM_NAME_SIZE);
+        std::memcpy(slot.name, slot_name.c_str(), slot_name.size());
+        slot.flags = entry.writable ? JACKALOPE_SHM_SLOT_WRITABLE : 0;
+        slot.current.store({ 0, 0 });
+
+        bindings.push_back({ entry.node, entry.name, entry.is_property, slot.target_sequence.load(std::memory_order_acquire) });
+    }
+
+    header->num_slots.store(bindings.size(), std::memory_order_release);
+    header->table_version.fetch_add(1, std::memory_order_release);
+}
+
+void shm_segment_t::update()
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    // the slots of a node are next to each other so the stats are only
+    // gathered once per node
+    shared_t<node_t> stats_node = nullptr;
+    pool_map_t<string_t, real_t> stats;
+
+    for(size_t i = 0; i < bindings.size(); i++) {
+        auto& binding = bindings[i];
+        auto& slot = slots[i];
+        auto node = binding.node.lock();
+
+        if (node == nullptr) {
+            continue;
+        }
+
+        // properties are read by their nodes once per block so a
+        // target takes effect on the next block boundary
+        if (slot.flags & JACKALOPE_SHM_SLOT_WRITABLE) {
+            auto target_sequence = slot.target_sequence.load(std::memory_order_acquire);
+
+            if (target_sequence != binding.applied_target) {
+                node->get_property(binding.name)->set(slot.target.load(std::memory_order_relaxed));
+                binding.applied_target = target_sequence;
+            }
+        }
+
+        double value;
+
+        if (binding.is_property) {
+            auto property = node->get_property(binding.name);
+
+            if (! property->is_defined()) {
+                continue;
+            }
+
+            value = property->get_number();
+        } else {
+            if (stats_node != node) {
+                stats = node->get_stats();
+                stats_node = node;
+            }
+
+            auto found = stats.find(binding.name);
+
+            if (found == stats.end()) {
+                continue;
+            }
+
+            value = found->second;
+        }
+
+        auto current = slot.current.load();
+
+        if (current.updates == 0 || current.value != value) {
+            slot.current.store({ value, current.updates + 1 });
+        }
+    }
+}
+
+void shm_segment_t::run()
+{
+    while(run_flag.load(std::memory_order_relaxed)) {
+        update();
+        std::this_thread::sleep_for(std::chrono::milliseconds(JACKALOPE_SHM_INTERVAL_MS));
+    }
+}
+
+void shm_segment_t::start()
+{
+    assert(thread == nullptr);
+
+    run_flag = true;
+    thread = new thread_t([this] { run(); });
+}
+
+void shm_segment_t::stop()
+{
+    if (thread == nullptr) {
+        return;
+    }
+
+    run_flag = false;
+    thread->join();
+
+    delete thread;
+    thread = nullptr;
+}
+
+} //namespace jackalope
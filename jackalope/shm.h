@@ -0,0 +1,98 @@
+// Jackalope Audio Engine
+// Copyright 2019 Tyler Riddle <kg7oem@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+
+
+#pragma once
+
+#include <cstdint>
+
+#include <jackalope/node.forward.h>
+#include <jackalope/thread.h>
+#include <jackalope/types.h>
+
+#define JACKALOPE_SHM_MAGIC                0x4a4b4c53
+#define JACKALOPE_SHM_VERSION              1
+#define JACKALOPE_SHM_NAME_SIZE            96
+#define JACKALOPE_SHM_DEFAULT_SLOTS        4096
+// how often values are published and written targets are applied
+#define JACKALOPE_SHM_INTERVAL_MS          5
+// external processes may write a target to the slot
+#define JACKALOPE_SHM_SLOT_WRITABLE        1
+
+namespace jackalope {
+
+struct shm_value_t {
+    double value;
+    // counts publishes of the slot
+    uint64_t updates;
+};
+
+// the segment is a shm_header_t followed by max_slots of these; a slot
+// name is "<node name>/<property or stat name>". Readers copy current
+// with the seqlock protocol: read an even sequence, copy the value then
+// check the sequence did not change. Writers store target then add one
+// to target_sequence.
+struct shm_slot_t {
+    char name[JACKALOPE_SHM_NAME_SIZE];
+    uint32_t flags;
+    seqlock_t<shm_value_t> current;
+    atomic_t<uint64_t> target_sequence;
+    atomic_t<double> target;
+};
+
+struct shm_header_t {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t slot_size;
+    uint32_t max_slots;
+    // odd while the slot table is being rebuilt; slot names and flags
+    // only change when this does
+    atomic_t<uint64_t> table_version;
+    atomic_t<uint32_t> num_slots;
+};
+
+// a POSIX shared memory segment holding every numeric property and
+// stat of a graph's nodes
+class shm_segment_t : public base_t {
+
+protected:
+    struct binding_t {
+        weak_t<node_t> node;
+        string_t name;
+        bool is_property;
+        uint64_t applied_target;
+    };
+
+    const string_t name;
+    size_t size = 0;
+    shm_header_t * header = nullptr;
+    shm_slot_t * slots = nullptr;
+    pool_vector_t<binding_t> bindings;
+    std::mutex mutex;
+    thread_t * thread = nullptr;
+    atomic_t<bool> run_flag = ATOMIC_VAR_INIT(false);
+
+    void run();
+
+public:
+    shm_segment_t(const string_t& name_in, const size_t max_slots_in);
+    ~shm_segment_t();
+    // lays the slot table out again for the given nodes
+    void rebuild(const pool_vector_t<shared_t<node_t>>& nodes_in);
+    // applies written targets then publishes the current values
+    void update();
+    void start();
+    void stop();
+};
+
+} //namespace jackalope
@@ -19,22 +19,39 @@
 
 namespace jackalope {
 
-signal_t::subscription_t::subscription_t(shared_t<object_t> subscriber_in, const string_t& slot_name_in)
-: weak_subscriber(subscriber_in), slot_name(slot_name_in)
+signal_t::subscription_t::subscription_t(shared_t<object_t> subscriber_in, shared_t<slot_t> slot_in)
+: weak_subscriber(subscriber_in), slot(slot_in)
 {
     assert(subscriber_in != nullptr);
     assert(! weak_subscriber.expired());
-    assert(slot_name_in != "");
+    assert(slot_in != nullptr);
 }
 
 signal_t::signal_t(const string_t& name_in)
 : name(name_in)
 { }
 
-void signal_t::subscribe(shared_t<object_t> object_in, const string_t& name_in)
+void signal_t::subscribe(shared_t<object_t> object_in, shared_t<slot_t> slot_in)
 {
     auto lock = get_object_lock();
-    subscriptions.emplace(subscriptions.end(), object_in, name_in);
+    subscriptions.emplace(subscriptions.end(), object_in, slot_in);
+}
+
+size_t signal_t::add_callback(slot_function_t callback_in)
+{
+    auto lock = get_object_lock();
+    auto id = next_callback_id++;
+
+    callbacks.emplace(id, callback_in);
+
+    return id;
+}
+
+void signal_t::remove_callback(const size_t id_in)
+{
+    auto lock = get_object_lock();
+
+    callbacks.erase(id_in);
 }
 
 void signal_t::send()
@@ -45,16 +62,25 @@ void signal_t::send()
         i.set_value();
     }
 
-    waiters.empty();
+    waiters.clear();
+
+    for(auto& i : callbacks) {
+        i.second();
+    }
+
+    auto i = subscriptions.begin();
 
-    for (auto i = subscriptions.begin(); i != subscriptions.end(); i++) {
-        try {
-            auto subscriber = i->weak_subscriber.lock();
-            subscriber->send_message<invoke_slot_message_t>(i->slot_name);
-        } catch (const std::bad_weak_ptr&) {
-            subscriptions.erase(i);
+    while(i != subscriptions.end()) {
+        auto subscriber = i->weak_subscriber.lock();
+
+        // the subscriber went away so the subscription is dropped
+        if (subscriber == nullptr) {
+            i = subscriptions.erase(i);
             continue;
         }
+
+        subscriber->send_message<invoke_slot_message_t>(i->slot);
+        i++;
     }
 }
 
@@ -83,17 +109,30 @@ void slot_t::invoke()
 
 shared_t<signal_t> signal_obj_t::add_signal(const string_t& name_in)
 {
-    if (signals.find(name_in) != signals.end()) {
+    auto symbol = symbol_t(name_in);
+
+    if (signals.find(symbol) != signals.end()) {
         throw_runtime_error("Duplicate signal name: ", name_in);
     }
 
     auto signal = jackalope::make_shared<signal_t>(name_in);
-    signals.insert({ name_in, signal });
+    signals.insert({ symbol, signal });
 
     return signal;
 }
 
 shared_t<signal_t> signal_obj_t::get_signal(const string_t& name_in)
+{
+    auto symbol = symbol_t::find(name_in);
+
+    if (! symbol.is_valid()) {
+        throw_runtime_error("Could not find a signal: ", name_in);
+    }
+
+    return get_signal(symbol);
+}
+
+shared_t<signal_t> signal_obj_t::get_signal(const symbol_t& name_in)
 {
     auto found = signals.find(name_in);
 
@@ -106,7 +145,7 @@ shared_t<signal_t> signal_obj_t::get_signal(const string_t& name_in)
 
 shared_t<slot_t> signal_obj_t::add_slot(shared_t<slot_t> slot_in)
 {
-    auto name = slot_in->name;
+    auto name = symbol_t(slot_in->name);
 
     if (slots.find(name) != slots.end()) {
         throw_runtime_error("Duplicate slot name: ", name);
@@ -124,6 +163,17 @@ shared_t<slot_t> signal_obj_t::add_slot(const string_t& name_in, slot_function_t
 }
 
 shared_t<slot_t> signal_obj_t::get_slot(const string_t& name_in)
+{
+    auto symbol = symbol_t::find(name_in);
+
+    if (! symbol.is_valid()) {
+        throw_runtime_error("could not find a slot: ", name_in);
+    }
+
+    return get_slot(symbol);
+}
+
+shared_t<slot_t> signal_obj_t::get_slot(const symbol_t& name_in)
 {
     auto found = slots.find(name_in);
 
@@ -16,6 +16,7 @@
 #include <jackalope/message.h>
 #include <jackalope/object.forward.h>
 #include <jackalope/string.h>
+#include <jackalope/symbol.h>
 #include <jackalope/types.h>
 
 #define JACKALOPE_MESSAGE_OBJECT_INVOKE_SLOT "object.invoke_slot"
@@ -33,20 +34,27 @@ struct signal_t : public base_t, public shared_obj_t<signal_t>, lockable_t {
 public:
     struct subscription_t {
         const weak_t<object_t> weak_subscriber;
-        const string_t slot_name;
+        const shared_t<slot_t> slot;
 
-        subscription_t(shared_t<object_t> subscriber_in, const string_t& slot_name_in);
+        subscription_t(shared_t<object_t> subscriber_in, shared_t<slot_t> slot_in);
     };
 
 protected:
     pool_list_t<subscription_t> subscriptions;
     pool_list_t<promise_t<void>> waiters;
+    pool_map_t<size_t, slot_function_t> callbacks;
+    size_t next_callback_id = 1;
 
 public:
     const string_t name;
 
     signal_t(const string_t& name_in);
-    void subscribe(shared_t<object_t> object_in, const string_t& name_in);
+    // the slot must belong to the object
+    void subscribe(shared_t<object_t> object_in, shared_t<slot_t> slot_in);
+    // callbacks run in the thread that sends the signal while the
+    // signal is locked so they must be short and must not block
+    size_t add_callback(slot_function_t callback_in);
+    void remove_callback(const size_t id_in);
     void send();
     void wait();
 };
@@ -63,8 +71,8 @@ struct slot_t : public base_t, public shared_obj_t<slot_t> {
 class signal_obj_t {
 
 protected:
-    pool_map_t<string_t, shared_t<signal_t>> signals;
-    pool_map_t<string_t, shared_t<slot_t>> slots;
+    symbol_map_t<shared_t<signal_t>> signals;
+    symbol_map_t<shared_t<slot_t>> slots;
 
     virtual shared_t<signal_t> add_signal(const string_t& name_in);
     virtual shared_t<slot_t> add_slot(shared_t<slot_t> slot_in);
@@ -72,7 +80,9 @@ protected:
 
 public:
     virtual shared_t<signal_t> get_signal(const string_t& name_in);
+    virtual shared_t<signal_t> get_signal(const symbol_t& name_in);
     virtual shared_t<slot_t> get_slot(const string_t& name_in);
+    virtual shared_t<slot_t> get_slot(const symbol_t& name_in);
 };
 
 } // namespace jackalope
@@ -0,0 +1,109 @@
+// Jackalope Audio Engine
+// Copyright 2019 Tyler Riddle <kg7oem@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+
+#include <shared_mutex>
+
+#include <jackalope/exception.h>
+#include <jackalope/symbol.h>
+
+namespace jackalope {
+
+// names are never removed so the string pointers stay valid
+// for the life of the process
+struct symbol_table_t {
+    std::shared_mutex mutex;
+    pool_unordered_map_t<string_t, size_t, string_hash_t> ids;
+    pool_vector_t<const string_t *> names = { nullptr };
+};
+
+static symbol_table_t& get_symbol_table()
+{
+    static symbol_table_t table;
+    return table;
+}
+
+static size_t find_symbol_id(const string_t& name_in)
+{
+    auto& table = get_symbol_table();
+    std::shared_lock<std::shared_mutex> lock(table.mutex);
+
+    auto found = table.ids.find(name_in);
+
+    if (found == table.ids.end()) {
+        return 0;
+    }
+
+    return found->second;
+}
+
+static size_t intern_symbol(const string_t& name_in)
+{
+    auto id = find_symbol_id(name_in);
+
+    if (id != 0) {
+        return id;
+    }
+
+    auto& table = get_symbol_table();
+    std::unique_lock<std::shared_mutex> lock(table.mutex);
+
+    auto found = table.ids.find(name_in);
+
+    if (found != table.ids.end()) {
+        return found->second;
+    }
+
+    id = table.names.size();
+    auto result = table.ids.emplace(name_in, id);
+    table.names.push_back(&result.first->first);
+
+    return id;
+}
+
+symbol_t symbol_t::find(const string_t& name_in)
+{
+    symbol_t symbol;
+    symbol.id = find_symbol_id(name_in);
+    return symbol;
+}
+
+symbol_t::symbol_t(const string_t& name_in)
+: id(intern_symbol(name_in))
+{ }
+
+symbol_t::symbol_t(const char_t * name_in)
+: id(intern_symbol(name_in))
+{ }
+
+const string_t& symbol_t::get_name() const
+{
+    if (id == 0) {
+        throw_runtime_error("invalid symbol has no name");
+    }
+
+    auto& table = get_symbol_table();
+    std::shared_lock<std::shared_mutex> lock(table.mutex);
+
+    return *table.names[id];
+}
+
+std::ostream& operator<<(std::ostream& stream_in, const symbol_t& symbol_in)
+{
+    if (! symbol_in.is_valid()) {
+        return stream_in << "(invalid symbol)";
+    }
+
+    return stream_in << symbol_in.get_name();
+}
+
+} // namespace jackalope
@@ -0,0 +1,87 @@
+// Jackalope Audio Engine
+// Copyright 2019 Tyler Riddle <kg7oem@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+
+#pragma once
+
+#include <string_view>
+
+#include <jackalope/string.h>
+#include <jackalope/types.h>
+
+namespace jackalope {
+
+struct string_hash_t {
+    size_t operator()(const string_t& string_in) const noexcept
+    {
+        return std::hash<std::string_view>()(std::string_view(string_in.data(), string_in.size()));
+    }
+};
+
+// an interned name; symbols with the same name have the same id for
+// the life of the process so they can be compared and hashed as an
+// integer instead of as a string
+class symbol_t {
+
+protected:
+    // id 0 is never assigned to a name
+    size_t id = 0;
+
+public:
+    // returns an invalid symbol if the name was never interned
+    static symbol_t find(const string_t& name_in);
+
+    symbol_t() = default;
+    explicit symbol_t(const string_t& name_in);
+    explicit symbol_t(const char_t * name_in);
+
+    size_t get_id() const noexcept
+    {
+        return id;
+    }
+
+    bool is_valid() const noexcept
+    {
+        return id != 0;
+    }
+
+    const string_t& get_name() const;
+
+    bool operator==(const symbol_t& other_in) const noexcept
+    {
+        return id == other_in.id;
+    }
+
+    bool operator!=(const symbol_t& other_in) const noexcept
+    {
+        return id != other_in.id;
+    }
+
+    bool operator<(const symbol_t& other_in) const noexcept
+    {
+        return id < other_in.id;
+    }
+};
+
+struct symbol_hash_t {
+    size_t operator()(const symbol_t& symbol_in) const noexcept
+    {
+        return symbol_in.get_id();
+    }
+};
+
+template <typename T>
+using symbol_map_t = pool_unordered_map_t<symbol_t, T, symbol_hash_t>;
+
+std::ostream& operator<<(std::ostream& stream_in, const symbol_t& symbol_in);
+
+} // namespace jackalope
@@ -13,6 +13,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <condition_variable>
 #include <future>
 #include <mutex>
@@ -83,4 +84,46 @@ public:
     lock_t get_object_lock() noexcept;
 };
 
+// one writer publishes a copy of T that any number of readers can take
+// without a lock and without ever blocking the writer; T must be
+// trivially copyable
+template <typename T>
+class seqlock_t {
+
+protected:
+    atomic_t<size_t> sequence = ATOMIC_VAR_INIT(0);
+    T value;
+
+public:
+    void store(const T& value_in) noexcept
+    {
+        auto start = sequence.load(std::memory_order_relaxed);
+
+        sequence.store(start + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        value = value_in;
+        sequence.store(start + 2, std::memory_order_release);
+    }
+
+    T load() const noexcept
+    {
+        T copy;
+
+        while(1) {
+            auto before = sequence.load(std::memory_order_acquire);
+
+            if (before & 1) {
+                continue;
+            }
+
+            copy = value;
+            std::atomic_thread_fence(std::memory_order_acquire);
+
+            if (sequence.load(std::memory_order_relaxed) == before) {
+                return copy;
+            }
+        }
+    }
+};
+
 } // namespace jackalope
@@ -11,10 +11,38 @@
 // MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
 // GNU Lesser General Public License for more details.
 
+#include <new>
+
 #include <jackalope/types.h>
 
 namespace jackalope {
 
+static atomic_t<size_t> pool_allocations = ATOMIC_VAR_INIT(0);
+static atomic_t<size_t> pool_allocated_bytes = ATOMIC_VAR_INIT(0);
+
+char * pool_user_allocator_t::malloc(const size_type bytes_in)
+{
+    pool_allocations.fetch_add(1, std::memory_order_relaxed);
+    pool_allocated_bytes.fetch_add(bytes_in, std::memory_order_relaxed);
+
+    return new (std::nothrow) char[bytes_in];
+}
+
+void pool_user_allocator_t::free(char * const block_in)
+{
+    delete [] block_in;
+}
+
+size_t get_pool_allocations()
+{
+    return pool_allocations.load(std::memory_order_relaxed);
+}
+
+size_t get_pool_allocated_bytes()
+{
+    return pool_allocated_bytes.load(std::memory_order_relaxed);
+}
+
 runtime_error_t::runtime_error_t(const std::string& what_in)
 : std::runtime_error(what_in)
 { }
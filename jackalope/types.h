@@ -16,12 +16,14 @@
 #include <atomic>
 #include <boost/pool/pool_alloc.hpp>
 #include <complex>
+#include <cstddef>
 #include <exception>
 #include <functional>
 #include <list>
 #include <map>
 #include <memory>
 #include <tuple>
+#include <unordered_map>
 #include <vector>
 
 // g++ 6.3.0 as it comes in debian/stretch does not support maybe_unused
@@ -51,12 +53,28 @@ using function_t = std::function<T>;
 template <typename... T>
 using tuple_t = std::tuple<T...>;
 
+// the pools get their memory from the system through this so the
+// number of times a pool had to grow can be counted
+struct pool_user_allocator_t {
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+    static char * malloc(const size_type bytes_in);
+    static void free(char * const block_in);
+};
+
+// totals for every pool in the process since it started
+size_t get_pool_allocations();
+size_t get_pool_allocated_bytes();
+
 template <typename T>
-using pool_allocator_t = boost::pool_allocator<T>;
+using pool_allocator_t = boost::pool_allocator<T, pool_user_allocator_t>;
 template <typename T>
 using pool_list_t = std::list<T, pool_allocator_t<T>>;
 template <class Key, class T, class Compare = std::less<Key>>
 using pool_map_t = std::map<Key, T, Compare, pool_allocator_t<std::pair<const Key, T>>>;
+template <class Key, class T, class Hash = std::hash<Key>>
+using pool_unordered_map_t = std::unordered_map<Key, T, Hash, std::equal_to<Key>, pool_allocator_t<std::pair<const Key, T>>>;
 template <typename T>
 using pool_vector_t = std::vector<T, pool_allocator_t<T>>;
 
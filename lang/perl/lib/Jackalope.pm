@@ -22,10 +22,13 @@ use strict;
 use warnings;
 use v5.10;
 
+use Jackalope::Batch;
 use Jackalope::Glue;
 use Jackalope::Graph;
 use Jackalope::Node;
 use Jackalope::Object;
+use Jackalope::Property;
+use Jackalope::Watch;
 
 our $VERSION = 0.0.1;
 
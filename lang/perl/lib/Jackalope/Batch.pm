@@ -0,0 +1,59 @@
+# Jackalope Audio Engine
+# Copyright 2019 Tyler Riddle <kg7oem@gmail.com>
+
+#This source code is licensed according to the Perl Artistic License 2.0 of
+#which you can find a copy in the doc/ subdirectory of this project.
+
+#This license establishes the terms under which a given free software Package
+#may be copied, modified, distributed, and/or redistributed.The intent is that
+#the Copyright Holder maintains some artistic control over the development of
+#that Package while still keeping the Package available as open source and
+#free software.
+
+#You are always permitted to make arrangements wholly outside of this license
+#directly with the Copyright Holder of a given Package. If the terms of this
+#license do not permit the full use that you propose to make of the Package,
+#you should contact the Copyright Holder and seek a different licensing
+#arrangement.
+
+package Jackalope::Batch;
+
+use strict;
+use warnings;
+use v5.10;
+
+use Jackalope::Glue;
+use Jackalope::Node;
+
+sub new {
+    my ($class, $graph) = @_;
+    my $batch = Jackalope::Glue::jackalope_batch_make($graph);
+
+    bless($batch, $class);
+
+    return $batch;
+}
+
+sub get_node {
+    my ($self, $op) = @_;
+    my $node = Jackalope::Glue::jackalope_batch_get_node($self, $op);
+
+    return undef unless defined $node;
+
+    bless($node, 'Jackalope::Node');
+
+    return $node;
+}
+
+*DESTROY = *Jackalope::Glue::jackalope_batch_delete;
+*make_node = *Jackalope::Glue::jackalope_batch_make_node;
+*remove_node = *Jackalope::Glue::jackalope_batch_remove_node;
+*link = *Jackalope::Glue::jackalope_batch_link;
+*unlink = *Jackalope::Glue::jackalope_batch_unlink;
+*forward = *Jackalope::Glue::jackalope_batch_forward;
+*poke = *Jackalope::Glue::jackalope_batch_poke;
+*subscribe = *Jackalope::Glue::jackalope_batch_subscribe;
+*submit = *Jackalope::Glue::jackalope_batch_submit;
+*get_error = *Jackalope::Glue::jackalope_batch_get_error;
+
+1;
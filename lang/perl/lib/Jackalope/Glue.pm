@@ -46,4 +46,35 @@ sub jackalope_graph_make_node {
     return _jackalope_graph_make_node($graph, $packed);
 }
 
+# numeric properties are read without a round trip through the
+# engine; returns one value per name with undef properties as NaN
+sub jackalope_object_peek_numbers {
+    my ($object, @names) = @_;
+    my $packed = pack_strings(@names);
+
+    return unpack("d*", _jackalope_object_peek_numbers($object, $packed, scalar(@names)));
+}
+
+# takes name => value pairs and sets all of them in one job
+sub jackalope_object_poke_numbers {
+    my ($object, @pairs) = @_;
+    my (@names, @values);
+
+    die "poke_numbers needs name => value pairs" if @pairs % 2;
+
+    while(my ($name, $value) = splice(@pairs, 0, 2)) {
+        push(@names, $name);
+        push(@values, $value);
+    }
+
+    _jackalope_object_poke_numbers($object, pack_strings(@names), pack("d*", @values), scalar(@names));
+}
+
+sub jackalope_batch_make_node {
+    my ($batch, @strings) = @_;
+    my $packed = pack_strings(@strings);
+
+    return _jackalope_batch_make_node($batch, $packed);
+}
+
 1;
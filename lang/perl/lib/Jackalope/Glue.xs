@@ -27,6 +27,9 @@ CODE:
 OUTPUT:
     RETVAL
 
+struct jackalope_object_t *
+jackalope_graph_load(const char * path_in)
+
 struct jackalope_object_t *
 _jackalope_graph_make_node(struct jackalope_object_t * object_in, char * strings_in)
 CODE:
@@ -37,6 +40,12 @@ OUTPUT:
 void
 jackalope_graph_run(struct jackalope_object_t * graph_in)
 
+void
+jackalope_graph_remove_node(struct jackalope_object_t * graph_in, const char * name_in)
+
+void
+jackalope_graph_replace_node(struct jackalope_object_t * graph_in, const char * name_in, struct jackalope_object_t * node_in)
+
 unsigned int
 jackalope_node_get_num_sources(struct jackalope_object_t * object_in)
 
@@ -45,3 +54,98 @@ jackalope_node_get_num_sinks(struct jackalope_object_t * object_in)
 
 void
 jackalope_node_link(struct jackalope_object_t * object_in, const char * source_in, struct jackalope_object_t * target_in, const char * sink_in)
+
+void
+jackalope_node_unlink(struct jackalope_object_t * object_in, const char * source_in, struct jackalope_object_t * target_in, const char * sink_in)
+
+struct jackalope_batch_t *
+jackalope_batch_make(struct jackalope_object_t * graph_in)
+
+void
+jackalope_batch_delete(struct jackalope_batch_t * batch_in)
+
+unsigned int
+_jackalope_batch_make_node(struct jackalope_batch_t * batch_in, char * strings_in)
+CODE:
+    RETVAL = jackalope_batch_make_node(batch_in, (const char **) strings_in);
+OUTPUT:
+    RETVAL
+
+unsigned int
+jackalope_batch_link(struct jackalope_batch_t * batch_in, const char * from_in, const char * source_in, const char * to_in, const char * sink_in)
+
+unsigned int
+jackalope_batch_unlink(struct jackalope_batch_t * batch_in, const char * from_in, const char * source_in, const char * to_in, const char * sink_in)
+
+unsigned int
+jackalope_batch_remove_node(struct jackalope_batch_t * batch_in, const char * name_in)
+
+unsigned int
+jackalope_batch_forward(struct jackalope_batch_t * batch_in, const char * from_in, const char * source_in, const char * to_in, const char * sink_in)
+
+unsigned int
+jackalope_batch_poke(struct jackalope_batch_t * batch_in, const char * object_in, const char * property_in, const char * value_in)
+
+unsigned int
+jackalope_batch_subscribe(struct jackalope_batch_t * batch_in, const char * from_in, const char * signal_in, const char * to_in, const char * slot_in)
+
+unsigned int
+jackalope_batch_submit(struct jackalope_batch_t * batch_in)
+
+const char *
+jackalope_batch_get_error(struct jackalope_batch_t * batch_in, unsigned int op_in)
+
+struct jackalope_object_t *
+jackalope_batch_get_node(struct jackalope_batch_t * batch_in, unsigned int op_in)
+
+void
+jackalope_object_delete(struct jackalope_object_t * object_in)
+
+SV *
+_jackalope_object_peek_numbers(struct jackalope_object_t * object_in, char * strings_in, unsigned int num_in)
+CODE:
+    RETVAL = newSV(num_in * sizeof(double) + 1);
+    SvPOK_on(RETVAL);
+    SvCUR_set(RETVAL, num_in * sizeof(double));
+    jackalope_object_peek_numbers(object_in, (const char **) strings_in, (double *) SvPVX(RETVAL), num_in);
+OUTPUT:
+    RETVAL
+
+void
+_jackalope_object_poke_numbers(struct jackalope_object_t * object_in, char * strings_in, char * values_in, unsigned int num_in)
+CODE:
+    jackalope_object_poke_numbers(object_in, (const char **) strings_in, (const double *) values_in, num_in);
+
+struct jackalope_property_t *
+jackalope_object_get_property(struct jackalope_object_t * object_in, const char * name_in)
+
+void
+jackalope_property_delete(struct jackalope_property_t * property_in)
+
+double
+jackalope_property_get_number(struct jackalope_property_t * property_in)
+
+void
+jackalope_property_set_number(struct jackalope_property_t * property_in, double value_in)
+
+struct jackalope_watch_t *
+jackalope_watch_make()
+
+void
+jackalope_watch_delete(struct jackalope_watch_t * watch_in)
+
+int
+jackalope_watch_get_fd(struct jackalope_watch_t * watch_in)
+
+void
+jackalope_watch_add(struct jackalope_watch_t * watch_in, struct jackalope_object_t * object_in, const char * signal_in, unsigned int id_in)
+
+void
+jackalope_watch_read(struct jackalope_watch_t * watch_in)
+PPCODE:
+    unsigned int ids[64];
+    unsigned int got = jackalope_watch_read(watch_in, ids, 64);
+
+    for(unsigned int i = 0; i < got; i++) {
+        XPUSHs(sv_2mortal(newSVuv(ids[i])));
+    }
@@ -36,6 +36,15 @@ sub new {
     return $graph;
 }
 
+sub load {
+    my ($class, $path) = @_;
+    my $graph = Jackalope::Glue::jackalope_graph_load($path);
+
+    bless($graph, $class);
+
+    return $graph;
+}
+
 sub make_node {
     my ($self, @strings) = @_;
     my $node = Jackalope::Glue::jackalope_graph_make_node($self, @strings);
@@ -46,5 +55,7 @@ sub make_node {
 }
 
 *run = *Jackalope::Glue::jackalope_graph_run;
+*remove_node = *Jackalope::Glue::jackalope_graph_remove_node;
+*replace_node = *Jackalope::Glue::jackalope_graph_replace_node;
 
 1;
@@ -29,5 +29,6 @@ use base qw(Jackalope::Object);
 *get_num_sources = *Jackalope::Glue::jackalope_node_get_num_sources;
 *get_num_sinks = *Jackalope::Glue::jackalope_node_get_num_sinks;
 *link = *Jackalope::Glue::jackalope_node_link;
+*unlink = *Jackalope::Glue::jackalope_node_unlink;
 
 1;
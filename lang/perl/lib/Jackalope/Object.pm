@@ -23,10 +23,21 @@ use warnings;
 use v5.10;
 
 use Jackalope::Glue;
+use Jackalope::Property;
+
+sub peek_number {
+    my ($self, $name) = @_;
+    my ($value) = $self->peek_numbers($name);
+
+    return $value;
+}
 
 *DESTROY = *Jackalope::Glue::jackalope_object_delete;
 *subscribe = *Jackalope::Glue::jackalope_object_subscribe;
 *start = *Jackalope::Glue::jackalope_object_start;
 *stop = *Jackalope::Glue::jackalope_object_stop;
+*peek_numbers = *Jackalope::Glue::jackalope_object_peek_numbers;
+*poke_numbers = *Jackalope::Glue::jackalope_object_poke_numbers;
+*property = *Jackalope::Glue::jackalope_object_get_property;
 
 1;
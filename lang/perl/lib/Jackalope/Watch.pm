@@ -0,0 +1,104 @@
+# Jackalope Audio Engine
+# Copyright 2019 Tyler Riddle <kg7oem@gmail.com>
+
+#This source code is licensed according to the Perl Artistic License 2.0 of
+#which you can find a copy in the doc/ subdirectory of this project.
+
+#This license establishes the terms under which a given free software Package
+#may be copied, modified, distributed, and/or redistributed.The intent is that
+#the Copyright Holder maintains some artistic control over the development of
+#that Package while still keeping the Package available as open source and
+#free software.
+
+#You are always permitted to make arrangements wholly outside of this license
+#directly with the Copyright Holder of a given Package. If the terms of this
+#license do not permit the full use that you propose to make of the Package,
+#you should contact the Copyright Holder and seek a different licensing
+#arrangement.
+
+package Jackalope::Watch;
+
+use strict;
+use warnings;
+use v5.10;
+
+use IO::Select;
+use Scalar::Util qw(refaddr);
+
+use Jackalope::Glue;
+
+# signals are delivered as ids on a pipe; handle() can be given to
+# any event loop and dispatch() runs the callbacks in this thread
+
+my %callbacks;
+my %handles;
+
+sub new {
+    my ($class) = @_;
+    my $watch = Jackalope::Glue::jackalope_watch_make();
+
+    bless($watch, $class);
+    $callbacks{refaddr($watch)} = [];
+
+    # the watch closes its own descriptor so the handle gets a copy
+    # that is closed along with it
+    open(my $handle, "<&", Jackalope::Glue::jackalope_watch_get_fd($watch))
+        or die "could not duplicate the watch descriptor: $!";
+
+    $handles{refaddr($watch)} = $handle;
+
+    return $watch;
+}
+
+sub add {
+    my ($self, $object, $signal, $callback) = @_;
+    my $list = $callbacks{refaddr($self)};
+
+    push(@$list, $callback);
+    Jackalope::Glue::jackalope_watch_add($self, $object, $signal, $#$list);
+
+    return;
+}
+
+sub handle {
+    my ($self) = @_;
+
+    return $handles{refaddr($self)};
+}
+
+# runs the callbacks for every pending signal and returns how many ran
+sub dispatch {
+    my ($self) = @_;
+    my $list = $callbacks{refaddr($self)};
+    my $count = 0;
+
+    while(my @ids = Jackalope::Glue::jackalope_watch_read($self)) {
+        foreach my $id (@ids) {
+            $list->[$id]->();
+            $count++;
+        }
+    }
+
+    return $count;
+}
+
+# blocks until at least one signal arrives or the timeout in seconds
+# runs out then dispatches
+sub wait {
+    my ($self, $timeout) = @_;
+    my $select = IO::Select->new($self->handle);
+
+    $select->can_read($timeout);
+
+    return $self->dispatch;
+}
+
+sub DESTROY {
+    my ($self) = @_;
+
+    delete $callbacks{refaddr($self)};
+    close(delete $handles{refaddr($self)});
+    Jackalope::Glue::jackalope_watch_delete($self);
+}
+
+1;
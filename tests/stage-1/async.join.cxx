@@ -0,0 +1,149 @@
+// Jackalope Audio Engine
+// Copyright 2019 Tyler Riddle <kg7oem@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+
+#include <jackalope/async.h>
+
+#include "tests.h"
+
+using namespace std::chrono_literals;
+using namespace jackalope;
+
+static shared_t<async_engine_t> make_engine(const size_t threads_in)
+{
+    return async_engine_t::make({ { JACKALOPE_ASYNC_PROPERTY_THREADS, to_string(threads_in) } });
+}
+
+// records the order the jobs finished in
+struct order_t {
+    mutex_t mutex;
+    pool_vector_t<size_t> finished;
+
+    async_job_t<void> job(const size_t num_in)
+    {
+        return [this, num_in] {
+            auto lock = lock_t(mutex);
+            finished.push_back(num_in);
+        };
+    }
+
+    size_t position(const size_t num_in)
+    {
+        for(size_t i = 0; i < finished.size(); i++) {
+            if (finished[i] == num_in) {
+                return i;
+            }
+        }
+
+        return finished.size();
+    }
+};
+
+// 0 -> 1 -> 3 and 0 -> 2 -> 3
+static void dependency_order()
+{
+    auto engine = make_engine(4);
+    async_join_t join(engine);
+    order_t order;
+
+    for(size_t i = 0; i < 4; i++) {
+        join.add_job(order.job(i));
+    }
+
+    join.add_dependency(1, 0);
+    join.add_dependency(2, 0);
+    join.add_dependency(3, 1);
+    join.add_dependency(3, 2);
+
+    join.run();
+
+    test_case(order.finished.size() == 4);
+    test_case(order.position(0) < order.position(1) && order.position(0) < order.position(2));
+    test_case(order.position(1) < order.position(3) && order.position(2) < order.position(3));
+}
+
+// every job waits on another one so the cycle has to be broken for
+// any of them to run
+static void cycle()
+{
+    auto engine = make_engine(2);
+    async_join_t join(engine);
+    order_t order;
+
+    for(size_t i = 0; i < 3; i++) {
+        join.add_job(order.job(i));
+    }
+
+    join.add_dependency(0, 2);
+    join.add_dependency(1, 0);
+    join.add_dependency(2, 1);
+
+    join.run();
+
+    test_case(order.finished.size() == 3);
+}
+
+// the job after a failed one never starts and the first failure is
+// the one that comes out of run()
+static void rethrow_first()
+{
+    auto engine = make_engine(1);
+    async_join_t join(engine);
+    bool second_ran = false;
+    string_t message;
+
+    auto first = join.add_job([] { throw std::runtime_error("first"); });
+    auto second = join.add_job([&] { second_ran = true; throw std::runtime_error("second"); });
+    join.add_dependency(second, first);
+
+    try {
+        join.run();
+    } catch (const std::runtime_error& e) {
+        message = e.what();
+    }
+
+    test_case(message == "first");
+    test_case(! second_ran);
+}
+
+// the only engine thread is busy with the job that calls run() so the
+// inner jobs have to run on that same thread
+static void nested_run()
+{
+    auto engine = make_engine(1);
+    promise_t<size_t> done;
+    auto result = done.get_future();
+
+    engine->submit_job([&] {
+        async_join_t join(engine);
+        order_t order;
+
+        join.add_job(order.job(0));
+        join.add_job(order.job(1));
+        join.run();
+
+        done.set_value(order.finished.size());
+    });
+
+    test_case(result.wait_for(5s) == std::future_status::ready);
+    test_case(result.get() == 2);
+}
+
+int main()
+{
+    start_testing(8);
+
+    run_test(dependency_order);
+    run_test(cycle);
+    run_test(rethrow_first);
+    run_test(nested_run);
+}
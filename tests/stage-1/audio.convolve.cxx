@@ -0,0 +1,75 @@
+// Jackalope Audio Engine
+// Copyright 2019 Tyler Riddle <kg7oem@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+
+#include <cmath>
+
+#include <jackalope/audio/convolve.h>
+
+#include "tests.h"
+
+using namespace jackalope;
+
+#define TEST_BLOCK_SIZE 4
+#define TEST_NUM_BLOCKS 4
+
+// an impulse response that is a single delayed impulse should
+// delay the input by the same amount
+static bool check_delay(const size_t delay_in)
+{
+    pool_vector_t<real_t> ir(delay_in + 1, 0);
+    ir[delay_in] = 1;
+
+    auto convolve_ir = jackalope::make_shared<audio::convolve_ir_t>(ir.data(), ir.size(), TEST_BLOCK_SIZE);
+    audio::convolver_t convolver(convolve_ir);
+
+    pool_vector_t<real_t> input(TEST_BLOCK_SIZE * TEST_NUM_BLOCKS);
+    pool_vector_t<real_t> output(input.size());
+
+    for(size_t i = 0; i < input.size(); i++) {
+        input[i] = i + 1;
+    }
+
+    for(size_t i = 0; i < TEST_NUM_BLOCKS; i++) {
+        convolver.process(input.data() + i * TEST_BLOCK_SIZE, output.data() + i * TEST_BLOCK_SIZE);
+    }
+
+    for(size_t i = 0; i < output.size(); i++) {
+        real_t expected = i < delay_in ? 0 : input[i - delay_in];
+
+        if (std::fabs(output[i] - expected) > 0.001) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static void single_partition()
+{
+    test_case(check_delay(0));
+    test_case(check_delay(2));
+}
+
+static void multiple_partitions()
+{
+    test_case(check_delay(5));
+    test_case(check_delay(11));
+}
+
+int main()
+{
+    start_testing(4);
+
+    run_test(single_partition);
+    run_test(multiple_partitions);
+}
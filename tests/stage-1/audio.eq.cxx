@@ -0,0 +1,108 @@
+// Jackalope Audio Engine
+// Copyright 2019 Tyler Riddle <kg7oem@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+
+#include <cmath>
+
+#include <jackalope/audio/eq.h>
+#include <jackalope/graph.h>
+
+#include "tests.h"
+
+using namespace jackalope;
+
+#define TEST_EQ_TYPE "test::eq"
+#define TEST_SAMPLE_RATE 48000
+
+static bool near(const real_t a_in, const real_t b_in)
+{
+    return std::fabs(a_in - b_in) < 0.0001;
+}
+
+// the gain of the filter at 0 Hz
+static real_t dc_gain(const audio::biquad_coefficients_t& c_in)
+{
+    return (c_in.b0 + c_in.b1 + c_in.b2) / (1 + c_in.a1 + c_in.a2);
+}
+
+struct test_eq_t : public audio::eq_node_t {
+    test_eq_t(const init_args_t init_args_in)
+    : audio::eq_node_t(init_args_in)
+    { }
+
+    using audio::eq_node_t::update_coefficients;
+};
+
+static shared_t<object_t> test_eq_constructor(const string_t&, const init_args_t& init_args_in)
+{
+    return jackalope::make_shared<test_eq_t>(init_args_in);
+}
+
+static void coefficients()
+{
+    auto flat = audio::make_biquad("peak", TEST_SAMPLE_RATE, 1000, 0.707, 0);
+    test_case(near(flat.b0, 1) && near(flat.b1, flat.a1) && near(flat.b2, flat.a2));
+
+    test_case(near(dc_gain(audio::make_biquad("lowpass", TEST_SAMPLE_RATE, 1000, 0.707, 0)), 1));
+    test_case(near(dc_gain(audio::make_biquad("highpass", TEST_SAMPLE_RATE, 1000, 0.707, 0)), 0));
+    test_case(near(dc_gain(audio::make_biquad("lowshelf", TEST_SAMPLE_RATE, 1000, 0.707, 6)), std::pow(10.0, 6 / 20.0)));
+}
+
+static void bad_values()
+{
+    bool threw = false;
+
+    try {
+        audio::make_biquad("peak", TEST_SAMPLE_RATE, 1000, 0, 0);
+    } catch (const std::runtime_error&) {
+        threw = true;
+    }
+
+    test_case(threw);
+    threw = false;
+
+    auto graph = graph_t::make({ { "pcm.sample_rate", to_string(TEST_SAMPLE_RATE) } });
+    shared_t<test_eq_t> node;
+
+    guard_object(graph, {
+        node = dynamic_pointer_cast<test_eq_t>(graph->make_node({
+            { "object.type", TEST_EQ_TYPE },
+            { "node.name", "eq" },
+            { "pcm.sample_rate", to_string(TEST_SAMPLE_RATE) },
+            { "pcm.buffer_size", "128" },
+        }));
+    });
+
+    guard_object(node, {
+        // an activated node keeps the band it had instead of throwing
+        node->get_property("config.band.1.q")->set(0);
+
+        try {
+            node->update_coefficients();
+        } catch (const std::runtime_error&) {
+            threw = true;
+        }
+
+        test_case(! threw);
+    });
+}
+
+int main()
+{
+    start_testing(6);
+
+    init();
+    add_object_constructor(TEST_EQ_TYPE, test_eq_constructor);
+
+    run_test(coefficients);
+    run_test(bad_values);
+}
@@ -0,0 +1,141 @@
+// Jackalope Audio Engine
+// Copyright 2019 Tyler Riddle <kg7oem@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+
+#include "driver.h"
+#include "tests.h"
+
+using namespace jackalope;
+
+#define TEST_BLOCK_SIZE 32
+#define TEST_REBLOCK_SIZE 1024
+#define TEST_NUM_BLOCKS 96
+
+static shared_t<node_t> make_reblock(shared_t<graph_t> graph_in, const string_t& name_in, const size_t size_in)
+{
+    return graph_in->make_node({
+        { "object.type", "audio::reblock" },
+        { "node.name", name_in },
+        { "pcm.sample_rate", "48000" },
+        { "pcm.buffer_size", to_string(size_in) },
+    });
+}
+
+// pushes blocks that count up by sample and checks the blocks that
+// come back are the same count behind by the latency of the chain; the
+// chain does not stall even though the first block has to wait for 31
+// more blocks before it can leave the larger reblock
+static void up_and_down()
+{
+    auto graph = graph_t::make({
+        { "pcm.sample_rate", "48000" },
+        { "pcm.buffer_size", to_string(TEST_BLOCK_SIZE) },
+    });
+
+    shared_t<test_driver_t> driver;
+    shared_t<node_t> up;
+
+    guard_object(graph, {
+        driver = make_test_driver(graph, TEST_BLOCK_SIZE);
+        up = make_reblock(graph, "up", TEST_REBLOCK_SIZE);
+        auto down = make_reblock(graph, "down", TEST_BLOCK_SIZE);
+
+        guard_object(driver, { guard_object(up, { driver->link("output", up, "input"); }); });
+        guard_object(up, { guard_object(down, { up->link("output", down, "input"); }); });
+        guard_object(down, { guard_object(driver, { down->link("output", driver, "input"); }); });
+
+        graph->start();
+    });
+
+    size_t latency = TEST_REBLOCK_SIZE - TEST_BLOCK_SIZE;
+    size_t pushed = 0;
+    size_t pulled = 0;
+    bool in_order = true;
+
+    for(size_t i = 0; i < TEST_NUM_BLOCKS; i++) {
+        auto buffer = jackalope::make_shared<audio_buffer_t>(TEST_BLOCK_SIZE);
+        auto samples = buffer->get_pointer();
+
+        for(size_t j = 0; j < TEST_BLOCK_SIZE; j++) {
+            samples[j] = ++pushed;
+        }
+
+        if (! guard_object(driver, { return driver->push(buffer); })) {
+            break;
+        }
+
+        auto result = guard_object(driver, { return driver->pull(); });
+
+        if (result == nullptr) {
+            break;
+        }
+
+        in_order = in_order && result->num_samples == TEST_BLOCK_SIZE;
+        samples = result->get_pointer();
+
+        for(size_t j = 0; j < result->num_samples; j++) {
+            pulled++;
+            real_t expected = pulled > latency ? pulled - latency : 0;
+            in_order = in_order && samples[j] == expected;
+        }
+    }
+
+    test_case(pulled == TEST_BLOCK_SIZE * TEST_NUM_BLOCKS);
+    test_case(in_order);
+    // the larger reblock only knows its latency once it has seen a block
+    test_case(guard_object(up, { return up->get_property(JACKALOPE_PROPERTY_NODE_LATENCY)->get_real(); }) == latency);
+
+    guard_object(graph, { graph->stop(); });
+}
+
+// a source that makes audio on its own is held back once the reblock
+// has queued what it can and runs again when the output is taken
+static void back_pressure()
+{
+    auto graph = graph_t::make({
+        { "pcm.sample_rate", "48000" },
+        { "pcm.buffer_size", to_string(TEST_BLOCK_SIZE) },
+    });
+
+    shared_t<test_source_t> source;
+    shared_t<test_driver_t> driver;
+
+    guard_object(graph, {
+        source = make_test_source(graph, TEST_BLOCK_SIZE);
+        driver = make_test_driver(graph, TEST_REBLOCK_SIZE);
+        auto reblock = make_reblock(graph, "reblock", TEST_REBLOCK_SIZE);
+
+        guard_object(source, { guard_object(reblock, { source->link("output", reblock, "input"); }); });
+        guard_object(reblock, { guard_object(driver, { reblock->link("output", driver, "input"); }); });
+
+        graph->start();
+    });
+
+    auto sent = source->wait_stopped();
+    test_case(sent > 0 && sent < TEST_SOURCE_MAX_BLOCKS);
+
+    test_case(guard_object(driver, { return driver->pull(); }) != nullptr);
+    test_case(source->wait_stopped() > sent);
+
+    guard_object(graph, { graph->stop(); });
+}
+
+int main()
+{
+    start_testing(6);
+
+    init();
+    test_driver_init();
+
+    run_test(up_and_down);
+    run_test(back_pressure);
+}
@@ -0,0 +1,102 @@
+// Jackalope Audio Engine
+// Copyright 2019 Tyler Riddle <kg7oem@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+
+#include <cmath>
+
+#include <jackalope/audio/resample.h>
+
+#include "driver.h"
+#include "tests.h"
+
+using namespace jackalope;
+
+#define TEST_BLOCK_SIZE 441
+#define TEST_NUM_BLOCKS 20
+
+static void output_count()
+{
+    audio::resampler_t resampler(44100, 48000, audio::resample_quality_taps(JACKALOPE_AUDIO_RESAMPLE_QUALITY_MEDIUM));
+    pool_vector_t<real_t> input(TEST_BLOCK_SIZE, 0);
+    pcm_ring_t<real_t> output;
+
+    for(size_t i = 0; i < TEST_NUM_BLOCKS; i++) {
+        resampler.process(input.data(), input.size(), output);
+    }
+
+    test_case(output.size() == TEST_BLOCK_SIZE * TEST_NUM_BLOCKS * 48000 / 44100);
+}
+
+static void unity_gain()
+{
+    audio::resampler_t resampler(48000, 44100, audio::resample_quality_taps(JACKALOPE_AUDIO_RESAMPLE_QUALITY_HIGH));
+    pool_vector_t<real_t> input(TEST_BLOCK_SIZE, 1);
+    pcm_ring_t<real_t> output;
+
+    for(size_t i = 0; i < TEST_NUM_BLOCKS; i++) {
+        resampler.process(input.data(), input.size(), output);
+    }
+
+    pool_vector_t<real_t> result(output.size());
+    output.read(result.data(), result.size());
+
+    test_case(std::fabs(result.back() - 1) < 0.001);
+}
+
+// a source that makes audio on its own is held back once the resampler
+// has queued what it can and runs again when the output is taken
+static void back_pressure()
+{
+    auto graph = graph_t::make({
+        { "pcm.sample_rate", "48000" },
+        { "pcm.buffer_size", "480" },
+    });
+
+    shared_t<test_source_t> source;
+    shared_t<test_driver_t> driver;
+
+    guard_object(graph, {
+        source = make_test_source(graph, TEST_BLOCK_SIZE);
+        driver = make_test_driver(graph, 480);
+
+        auto resample = graph->make_node({
+            { "object.type", JACKALOPE_AUDIO_RESAMPLE_OBJECT_TYPE },
+            { "node.name", "resample" },
+            { "config.input_rate", "44100" },
+        });
+
+        guard_object(source, { guard_object(resample, { source->link("output", resample, "input"); }); });
+        guard_object(resample, { guard_object(driver, { resample->link("output", driver, "input"); }); });
+
+        graph->start();
+    });
+
+    auto sent = source->wait_stopped();
+    test_case(sent > 0 && sent < TEST_SOURCE_MAX_BLOCKS);
+
+    test_case(guard_object(driver, { return driver->pull(); }) != nullptr);
+    test_case(source->wait_stopped() > sent);
+
+    guard_object(graph, { graph->stop(); });
+}
+
+int main()
+{
+    start_testing(5);
+
+    init();
+    test_driver_init();
+
+    run_test(output_count);
+    run_test(unity_gain);
+    run_test(back_pressure);
+}
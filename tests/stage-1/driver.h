@@ -0,0 +1,214 @@
+// Jackalope Audio Engine
+// Copyright 2019 Tyler Riddle <kg7oem@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+
+#pragma once
+
+#include <chrono>
+#include <thread>
+
+#include <jackalope/audio.h>
+#include <jackalope/graph.h>
+#include <jackalope/pcm.h>
+#include <jackalope/plugin.h>
+
+#define TEST_DRIVER_TYPE "test::driver"
+#define TEST_DRIVER_TIMEOUT_MS 1000
+#define TEST_SOURCE_TYPE "test::source"
+#define TEST_SOURCE_MAX_BLOCKS 1000
+
+// the test thread plays the part of the audio thread: push() sends a
+// block out of the source "output" and pull() takes the mix of what
+// came back on the sink "input"
+struct test_driver_t : public jackalope::driver_t {
+    jackalope::condition_t period_cond;
+
+    test_driver_t(const jackalope::init_args_t init_args_in)
+    : jackalope::driver_t(init_args_in)
+    { }
+
+    virtual void init() override
+    {
+        add_property(JACKALOPE_PROPERTY_PCM_BUFFER_SIZE, jackalope::property_t::type_t::size, init_args);
+        driver_t::init();
+    }
+
+    virtual void activate() override
+    {
+        add_source("output", JACKALOPE_TYPE_AUDIO);
+        add_sink("input", JACKALOPE_TYPE_AUDIO);
+        driver_t::activate();
+    }
+
+    virtual bool should_execute() override
+    {
+        return false;
+    }
+
+    virtual void execute() override
+    { }
+
+    virtual void sink_ready(jackalope::shared_t<jackalope::sink_t> sink_in) override
+    {
+        period_cond.notify_all();
+        driver_t::sink_ready(sink_in);
+    }
+
+    virtual void source_available(jackalope::shared_t<jackalope::source_t> source_in) override
+    {
+        period_cond.notify_all();
+        driver_t::source_available(source_in);
+    }
+
+    jackalope::size_t get_buffer_size()
+    {
+        return get_property(JACKALOPE_PROPERTY_PCM_BUFFER_SIZE)->get_size();
+    }
+
+    bool push(jackalope::shared_t<jackalope::audio_buffer_t> buffer_in)
+    {
+        auto timeout = std::chrono::milliseconds(TEST_DRIVER_TIMEOUT_MS);
+
+        if (! period_cond.wait_for(object_mutex, timeout, [this] { return sources_available(); })) {
+            return false;
+        }
+
+        get_source<jackalope::audio_source_t>(0)->notify_buffer(buffer_in);
+
+        return true;
+    }
+
+    // every sample of the block is set to value_in
+    bool push(const jackalope::real_t value_in)
+    {
+        auto buffer = jackalope::make_shared<jackalope::audio_buffer_t>(get_buffer_size());
+        jackalope::pcm_set(buffer->get_pointer(), value_in, buffer->num_samples);
+
+        return push(buffer);
+    }
+
+    bool wait_ready()
+    {
+        auto timeout = std::chrono::milliseconds(TEST_DRIVER_TIMEOUT_MS);
+
+        return period_cond.wait_for(object_mutex, timeout, [this] { return driver_t::should_execute(); });
+    }
+
+    // returns nullptr if nothing came back
+    jackalope::shared_t<jackalope::audio_buffer_t> pull()
+    {
+        if (! wait_ready()) {
+            return nullptr;
+        }
+
+        auto sink = get_sink<jackalope::audio_sink_t>(0);
+        auto buffer = sink->get_buffer();
+        sink->reset();
+
+        return buffer;
+    }
+};
+
+// makes audio on its own like a file player would: a block is sent out
+// of "output" every time the source is available, up to
+// TEST_SOURCE_MAX_BLOCKS blocks; each sample of a block is the count
+// of blocks sent
+struct test_source_t : public jackalope::plugin_t {
+    jackalope::size_t sent = 0;
+
+    test_source_t(const jackalope::init_args_t init_args_in)
+    : jackalope::plugin_t(init_args_in)
+    { }
+
+    virtual void init() override
+    {
+        add_property(JACKALOPE_PROPERTY_PCM_BUFFER_SIZE, jackalope::property_t::type_t::size, init_args);
+        plugin_t::init();
+    }
+
+    virtual void activate() override
+    {
+        add_source("output", JACKALOPE_TYPE_AUDIO);
+        plugin_t::activate();
+    }
+
+    virtual bool should_execute() override
+    {
+        auto source = _get_source(0);
+
+        return sent < TEST_SOURCE_MAX_BLOCKS && source->has_links() && source->is_available();
+    }
+
+    virtual void execute() override
+    {
+        auto buffer_size = get_property(JACKALOPE_PROPERTY_PCM_BUFFER_SIZE)->get_size();
+        auto buffer = jackalope::make_shared<jackalope::audio_buffer_t>(buffer_size);
+        jackalope::pcm_set(buffer->get_pointer(), static_cast<jackalope::real_t>(++sent), buffer_size);
+
+        get_source<jackalope::audio_source_t>(0)->notify_buffer(buffer);
+    }
+
+    // waits for the source to stop sending and returns how many blocks
+    // it sent
+    jackalope::size_t wait_stopped()
+    {
+        auto last = guard_lockable({ return sent; });
+
+        for(jackalope::size_t i = 0; i < TEST_DRIVER_TIMEOUT_MS / 20; i++) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+            auto now = guard_lockable({ return sent; });
+
+            if (now == last) {
+                break;
+            }
+
+            last = now;
+        }
+
+        return last;
+    }
+};
+
+inline jackalope::shared_t<jackalope::object_t> test_driver_constructor(const jackalope::string_t&, const jackalope::init_args_t& init_args_in)
+{
+    return jackalope::make_shared<test_driver_t>(init_args_in);
+}
+
+inline jackalope::shared_t<jackalope::object_t> test_source_constructor(const jackalope::string_t&, const jackalope::init_args_t& init_args_in)
+{
+    return jackalope::make_shared<test_source_t>(init_args_in);
+}
+
+inline void test_driver_init()
+{
+    jackalope::add_object_constructor(TEST_DRIVER_TYPE, test_driver_constructor);
+    jackalope::add_object_constructor(TEST_SOURCE_TYPE, test_source_constructor);
+}
+
+inline jackalope::shared_t<test_driver_t> make_test_driver(jackalope::shared_t<jackalope::graph_t> graph_in, const jackalope::size_t buffer_size_in)
+{
+    return jackalope::dynamic_pointer_cast<test_driver_t>(graph_in->make_node({
+        { "object.type", TEST_DRIVER_TYPE },
+        { "node.name", "driver" },
+        { "pcm.buffer_size", jackalope::to_string(buffer_size_in) },
+    }));
+}
+
+inline jackalope::shared_t<test_source_t> make_test_source(jackalope::shared_t<jackalope::graph_t> graph_in, const jackalope::size_t buffer_size_in)
+{
+    return jackalope::dynamic_pointer_cast<test_source_t>(graph_in->make_node({
+        { "object.type", TEST_SOURCE_TYPE },
+        { "node.name", "source" },
+        { "pcm.buffer_size", jackalope::to_string(buffer_size_in) },
+    }));
+}
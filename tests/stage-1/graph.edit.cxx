@@ -0,0 +1,216 @@
+// Jackalope Audio Engine
+// Copyright 2019 Tyler Riddle <kg7oem@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+
+#include <jackalope/network.h>
+
+#include "driver.h"
+#include "tests.h"
+
+using namespace jackalope;
+
+#define TEST_BLOCK_SIZE 32
+
+static shared_t<node_t> make_gain(shared_t<graph_t> graph_in, const string_t& name_in)
+{
+    return graph_in->make_node({
+        { "object.type", "audio::gain" },
+        { "node.name", name_in },
+        { "config.gain", "0" },
+        { "pcm.sample_rate", "48000" },
+        { "pcm.buffer_size", to_string(TEST_BLOCK_SIZE) },
+    });
+}
+
+static void link_nodes(shared_t<node_t> from_in, const string_t& source_in, shared_t<node_t> to_in, const string_t& sink_in)
+{
+    guard_object(from_in, {
+        guard_object(to_in, { from_in->link(source_in, to_in, sink_in); });
+    });
+}
+
+// driver -> every named gain -> driver
+static shared_t<test_driver_t> make_loop(shared_t<graph_t> graph_in, const pool_vector_t<string_t>& names_in)
+{
+    auto driver = make_test_driver(graph_in, TEST_BLOCK_SIZE);
+
+    for(auto& name : names_in) {
+        auto gain = make_gain(graph_in, name);
+
+        link_nodes(driver, "output", gain, "input");
+        link_nodes(gain, "output", driver, "input");
+    }
+
+    graph_in->start();
+
+    return driver;
+}
+
+static bool push(shared_t<test_driver_t> driver_in, const real_t value_in)
+{
+    return guard_object(driver_in, { return driver_in->push(value_in); });
+}
+
+// returns -1 if nothing came back
+static real_t pull(shared_t<test_driver_t> driver_in)
+{
+    auto buffer = guard_object(driver_in, { return driver_in->pull(); });
+
+    if (buffer == nullptr) {
+        return -1;
+    }
+
+    return buffer->get_pointer()[0];
+}
+
+// the first block is waiting at the driver and the second is waiting
+// in front of the gain because the gain can not send until the driver
+// takes the first
+static void fill_loop(shared_t<test_driver_t> driver_in)
+{
+    push(driver_in, 1);
+    push(driver_in, 2);
+    guard_object(driver_in, { driver_in->wait_ready(); });
+}
+
+// the blocks held by the old node's links move to the replacement
+static void replace_running()
+{
+    auto graph = graph_t::make(init_args_t());
+    shared_t<test_driver_t> driver;
+
+    guard_object(graph, { driver = make_loop(graph, { "old" }); });
+
+    fill_loop(driver);
+
+    guard_object(graph, {
+        make_gain(graph, "new");
+        graph->replace_node("old", graph->get_node("new"));
+    });
+
+    test_case(pull(driver) == 1);
+    test_case(pull(driver) == 2);
+    test_case(push(driver, 3) && pull(driver) == 3);
+
+    guard_object(graph, { graph->stop(); });
+}
+
+// the blocks held by the removed node are dropped and the rest of the
+// graph keeps going
+static void remove_running()
+{
+    auto graph = graph_t::make(init_args_t());
+    shared_t<test_driver_t> driver;
+
+    guard_object(graph, { driver = make_loop(graph, { "kept", "removed" }); });
+
+    fill_loop(driver);
+
+    guard_object(graph, { graph->remove_node("removed"); });
+
+    test_case(pull(driver) == 1);
+    test_case(pull(driver) == 2);
+    test_case(push(driver, 3) && pull(driver) == 3);
+
+    guard_object(graph, { graph->stop(); });
+}
+
+// a node that loses its input link runs on silence
+static void unlink_running()
+{
+    auto graph = graph_t::make(init_args_t());
+    shared_t<test_driver_t> driver;
+
+    guard_object(graph, { driver = make_loop(graph, { "kept", "unlinked" }); });
+
+    fill_loop(driver);
+
+    auto unlinked = guard_object(graph, { return graph->get_node("unlinked"); });
+
+    guard_object(driver, {
+        guard_object(unlinked, { driver->unlink("output", unlinked, "input"); });
+    });
+
+    test_case(pull(driver) == 2);
+    test_case(pull(driver) == 2);
+    test_case(push(driver, 3) && pull(driver) == 3);
+
+    guard_object(graph, { graph->stop(); });
+}
+
+// the network is flattened when the graph starts and a link made to it
+// afterwards still reaches the node inside
+static void link_network_running()
+{
+    auto graph = graph_t::make(init_args_t());
+    shared_t<test_driver_t> driver;
+    shared_t<network_t> network;
+
+    guard_object(graph, {
+        driver = make_test_driver(graph, TEST_BLOCK_SIZE);
+        network = graph->make_network({ { "node.name", "network" } });
+
+        guard_object(network, {
+            network->add_sink("input", JACKALOPE_TYPE_AUDIO);
+            network->add_source("output", JACKALOPE_TYPE_AUDIO);
+
+            auto inner = network->make_node({
+                { "object.type", "audio::gain" },
+                { "node.name", "inner" },
+                { "config.gain", "0" },
+                { "pcm.sample_rate", "48000" },
+                { "pcm.buffer_size", to_string(TEST_BLOCK_SIZE) },
+            });
+
+            guard_object(inner, {
+                network->forward("input", inner, "input");
+                inner->forward("output", network, "output");
+            });
+        });
+
+        link_nodes(driver, "output", network, "input");
+        link_nodes(network, "output", driver, "input");
+
+        graph->start();
+    });
+
+    test_case(push(driver, 1) && pull(driver) == 1);
+
+    auto late = guard_object(graph, { return make_gain(graph, "late"); });
+
+    // the new path is in place before the old one goes so the node
+    // inside never runs without an input
+    link_nodes(driver, "output", late, "input");
+    link_nodes(late, "output", network, "input");
+    guard_object(late, { late->start(); });
+
+    guard_object(driver, {
+        guard_object(network, { driver->unlink("output", network, "input"); });
+    });
+
+    test_case(push(driver, 2) && pull(driver) == 2);
+
+    guard_object(graph, { graph->stop(); });
+}
+
+int main()
+{
+    start_testing(11);
+
+    init();
+    test_driver_init();
+
+    run_test(replace_running);
+    run_test(remove_running);
+    run_test(unlink_running);
+    run_test(link_network_running);
+}
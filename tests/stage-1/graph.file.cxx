@@ -0,0 +1,72 @@
+// Jackalope Audio Engine
+// Copyright 2019 Tyler Riddle <kg7oem@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+
+
+#include <sstream>
+
+#include <jackalope/graph.file.h>
+
+#include "tests.h"
+
+using namespace jackalope;
+
+static bool parses(const char * json_in)
+{
+    std::istringstream input(json_in);
+
+    try {
+        graph_file_t::parse(input);
+    } catch (const std::runtime_error&) {
+        return false;
+    }
+
+    return true;
+}
+
+static void parse_file()
+{
+    std::istringstream input(R"({
+        "graph": { "pcm.sample_rate": 48000 },
+        "nodes": [
+            { "object.type": "audio::gain", "node.name": "left" },
+            { "object.type": "jackalope::network", "node.name": "net", "nodes": [
+                { "object.type": "audio::gain", "node.name": "inner" }
+            ] }
+        ],
+        "links": [ { "from": "left", "source": "output", "to": "net", "sink": "input" } ],
+        "subscriptions": [ { "from": "left", "signal": "object.stopped", "slot": "object.stop" } ]
+    })");
+
+    auto file = graph_file_t::parse(input);
+
+    test_case(file->graph_args.size() == 1 && file->graph_args[0].second == "48000");
+    test_case(file->nodes.size() == 2 && file->nodes.back().nodes.size() == 1);
+    test_case(file->links.size() == 1 && file->links.front().to_name == "input");
+    test_case(file->subscriptions.front().to == "");
+}
+
+static void validate_file()
+{
+    test_case(! parses(R"({ "nodes": [ { "object.type": "audio::gain" } ] })"));
+    test_case(! parses(R"({ "nodes": [ { "object.type": "audio::gain", "node.name": "a" }, { "object.type": "audio::gain", "node.name": "a" } ] })"));
+    test_case(! parses(R"({ "links": [ { "from": "a", "source": "output", "to": "b", "sink": "input" } ] })"));
+    test_case(! parses(R"({ "nodes": [ )"));
+}
+
+int main()
+{
+    start_testing(8);
+
+    run_test(parse_file);
+    run_test(validate_file);
+}
@@ -0,0 +1,180 @@
+// Jackalope Audio Engine
+// Copyright 2019 Tyler Riddle <kg7oem@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+
+#include <chrono>
+#include <future>
+
+#include <jackalope/audio.h>
+#include <jackalope/graph.h>
+#include <jackalope/plugin.h>
+
+#include "driver.h"
+#include "tests.h"
+
+using namespace jackalope;
+
+#define TEST_NODE_TYPE "test::latency"
+
+// a node that never runs and reports the latency it was made with
+struct test_node_t : public filter_plugin_t {
+    test_node_t(const init_args_t init_args_in)
+    : filter_plugin_t(init_args_in)
+    { }
+
+    virtual void init() override
+    {
+        add_property(JACKALOPE_PROPERTY_NODE_LATENCY, property_t::type_t::real, init_args);
+        filter_plugin_t::init();
+    }
+
+    virtual void activate() override
+    {
+        add_sink("input 1", JACKALOPE_TYPE_AUDIO);
+        add_sink("input 2", JACKALOPE_TYPE_AUDIO);
+        add_source("output", JACKALOPE_TYPE_AUDIO);
+        filter_plugin_t::activate();
+    }
+
+    virtual void execute() override
+    { }
+};
+
+static shared_t<object_t> test_node_constructor(const string_t&, const init_args_t& init_args_in)
+{
+    return jackalope::make_shared<test_node_t>(init_args_in);
+}
+
+static shared_t<node_t> make_test_node(shared_t<graph_t> graph_in, const string_t& name_in, const size_t latency_in)
+{
+    return graph_in->make_node({
+        { "object.type", TEST_NODE_TYPE },
+        { "node.name", name_in },
+        { JACKALOPE_PROPERTY_NODE_LATENCY, to_string(latency_in) },
+    });
+}
+
+static void link_nodes(shared_t<node_t> from_in, shared_t<node_t> to_in, const string_t& sink_in)
+{
+    guard_object(from_in, {
+        guard_object(to_in, { from_in->link("output", to_in, sink_in); });
+    });
+}
+
+static size_t get_delay(shared_t<node_t> node_in, const string_t& sink_in)
+{
+    return guard_object(node_in, {
+        return node_in->get_sink(sink_in)->get_links().front()->get_delay();
+    });
+}
+
+// source -> slow -> mix and source -> fast -> mix; the faster path is
+// delayed so both inputs of mix line up
+static void parallel_paths()
+{
+    auto graph = graph_t::make(init_args_t());
+
+    guard_object(graph, {
+        auto source = make_test_node(graph, "source", 5);
+        auto slow = make_test_node(graph, "slow", 100);
+        auto fast = make_test_node(graph, "fast", 10);
+        auto mix = make_test_node(graph, "mix", 1);
+
+        link_nodes(source, slow, "input 1");
+        link_nodes(source, fast, "input 1");
+        link_nodes(slow, mix, "input 1");
+        link_nodes(fast, mix, "input 2");
+
+        test_case(graph->compensate_latency() == 106);
+        test_case(get_delay(mix, "input 1") == 0);
+        test_case(get_delay(mix, "input 2") == 90);
+
+        // latency that changes after the first walk is picked up when
+        // the graph walks it again
+        guard_object(fast, { fast->get_property(JACKALOPE_PROPERTY_NODE_LATENCY)->set(30); });
+
+        test_case(graph->compensate_latency() == 106);
+        test_case(get_delay(mix, "input 2") == 70);
+    });
+}
+
+// a feedback loop is walked once and left uncompensated
+static void feedback_loop()
+{
+    auto graph = graph_t::make(init_args_t());
+
+    guard_object(graph, {
+        auto first = make_test_node(graph, "first", 10);
+        auto second = make_test_node(graph, "second", 20);
+
+        link_nodes(first, second, "input 1");
+        link_nodes(second, first, "input 1");
+
+        test_case(graph->compensate_latency() == 30);
+        test_case(get_delay(first, "input 1") == 0);
+    });
+}
+
+// a reblock only knows its latency once a block has gone through it;
+// the graph is started from a job on its own engine with one thread so
+// the warm up has to keep the engine going for the block to get there
+static void warm_up_latency()
+{
+    auto graph = graph_t::make({
+        { "pcm.sample_rate", "48000" },
+        { "pcm.buffer_size", "32" },
+        { "async.threads", "1" },
+        { "warm_up.blocks", "4" },
+    });
+
+    auto engine = guard_object(graph, {
+        auto driver = make_test_driver(graph, 32);
+        auto up = graph->make_node({ { "object.type", "audio::reblock" }, { "node.name", "up" }, { "pcm.buffer_size", "1024" } });
+        auto down = graph->make_node({ { "object.type", "audio::reblock" }, { "node.name", "down" } });
+
+        link_nodes(driver, up, "input");
+        link_nodes(up, down, "input");
+        link_nodes(down, driver, "input");
+
+        return graph->get_async_engine();
+    });
+
+    std::promise<void> started;
+    auto start_time = std::chrono::steady_clock::now();
+
+    engine->submit_job([&] {
+        guard_object(graph, { graph->start(); });
+        started.set_value();
+    });
+
+    started.get_future().wait();
+
+    auto elapsed = std::chrono::steady_clock::now() - start_time;
+
+    test_case(elapsed < std::chrono::milliseconds(JACKALOPE_DRIVER_WARM_UP_TIMEOUT_MS));
+    test_case(guard_object(graph, { return graph->get_property(JACKALOPE_PROPERTY_NODE_LATENCY)->get_real(); }) == 992);
+
+    guard_object(graph, { graph->stop(); });
+}
+
+int main()
+{
+    start_testing(9);
+
+    init();
+    add_object_constructor(TEST_NODE_TYPE, test_node_constructor);
+    test_driver_init();
+
+    run_test(parallel_paths);
+    run_test(feedback_loop);
+    run_test(warm_up_latency);
+}
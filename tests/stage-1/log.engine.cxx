@@ -0,0 +1,104 @@
+// Jackalope Audio Engine
+// Copyright 2019 Tyler Riddle <kg7oem@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+
+#include <jackalope/log/dest.h>
+#include <jackalope/log/engine.h>
+#include <jackalope/logging.h>
+
+#include "tests.h"
+
+using namespace jackalope;
+
+#define TEST_SOURCE "test source"
+#define OTHER_SOURCE "other source"
+
+struct test_dest_t : public log::dest_t {
+    size_t delivered = 0;
+
+    test_dest_t(const log::level_t min_level_in)
+    : log::dest_t(min_level_in)
+    { }
+
+    virtual void handle_event__e(const log::event_t&) noexcept
+    {
+        delivered++;
+    }
+};
+
+static void no_destinations()
+{
+    log::engine_t engine;
+
+    test_case(! engine.should_log(log::level_t::fatal, TEST_SOURCE));
+}
+
+static void min_level()
+{
+    log::engine_t engine;
+    auto dest = jackalope::make_shared<test_dest_t>(log::level_t::info);
+
+    engine.add_destination(dest);
+
+    test_case(! engine.should_log(log::level_t::trace, TEST_SOURCE));
+    test_case(engine.should_log(log::level_t::info, TEST_SOURCE));
+    test_case(engine.should_log(log::level_t::error, TEST_SOURCE));
+
+    auto when = std::chrono::system_clock::now();
+    auto tid = std::this_thread::get_id();
+    engine.deliver(log::event_t(TEST_SOURCE, log::level_t::info, when, tid, __PRETTY_FUNCTION__, __FILE__, __LINE__, "delivered"));
+    engine.deliver(log::event_t(TEST_SOURCE, log::level_t::debug, when, tid, __PRETTY_FUNCTION__, __FILE__, __LINE__, "filtered"));
+    test_case(dest->delivered == 1);
+}
+
+static void source_level()
+{
+    log::engine_t engine;
+    auto dest = jackalope::make_shared<test_dest_t>(log::level_t::info);
+
+    engine.add_destination(dest);
+    engine.set_source_level(TEST_SOURCE, log::level_t::error);
+
+    test_case(! engine.should_log(log::level_t::info, TEST_SOURCE));
+    test_case(engine.should_log(log::level_t::error, TEST_SOURCE));
+    test_case(engine.should_log(log::level_t::info, OTHER_SOURCE));
+
+    engine.clear_source_level(TEST_SOURCE);
+    test_case(engine.should_log(log::level_t::info, TEST_SOURCE));
+}
+
+// the log macros have to act like a single statement
+static void macro_statement()
+{
+    size_t branch = 0;
+
+    for(auto flag : { true, false }) {
+        if (flag)
+            log_trace("first branch");
+        else
+            log_trace("second branch");
+
+        branch++;
+    }
+
+    test_case(branch == 2);
+}
+
+int main()
+{
+    start_testing(10);
+
+    run_test(no_destinations);
+    run_test(min_level);
+    run_test(source_level);
+    run_test(macro_statement);
+}
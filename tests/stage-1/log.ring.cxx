@@ -0,0 +1,97 @@
+// Jackalope Audio Engine
+// Copyright 2019 Tyler Riddle <kg7oem@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+
+#include <cstdio>
+#include <sstream>
+
+#include <jackalope/log/ring.h>
+
+#include "tests.h"
+
+using namespace jackalope;
+
+#define TEST_SOURCE "test source"
+#define TEST_PATH "jackalope-test-1-log.ring.bin"
+#define TEST_RECORDS 4
+
+static void deliver_message(log::dest_t& dest_in, const string_t& message_in)
+{
+    auto when = std::chrono::system_clock::now();
+    auto tid = std::this_thread::get_id();
+
+    dest_in.handle_deliver(log::event_t(TEST_SOURCE, log::level_t::info, when, tid, __PRETTY_FUNCTION__, __FILE__, __LINE__, message_in));
+}
+
+static void round_trip()
+{
+    {
+        log::ring_dest_t dest(log::level_t::trace, TEST_PATH, TEST_RECORDS);
+        deliver_message(dest, "first message");
+    }
+
+    std::stringstream output;
+    test_case(log::decode_ring_file(TEST_PATH, output) == 1);
+    test_case(output.str().find("first message") != std::string::npos);
+    test_case(output.str().find(TEST_SOURCE) != std::string::npos);
+}
+
+static void wraps()
+{
+    {
+        log::ring_dest_t dest(log::level_t::trace, TEST_PATH, TEST_RECORDS);
+
+        for (size_t i = 0; i < TEST_RECORDS + 2; i++) {
+            deliver_message(dest, to_string("message ", i));
+        }
+    }
+
+    std::stringstream output;
+    test_case(log::decode_ring_file(TEST_PATH, output) == TEST_RECORDS);
+    test_case(output.str().find("message 1\n") == std::string::npos);
+    test_case(output.str().find("message 2\n") < output.str().find("message 5\n"));
+
+}
+
+// the file from the run before is moved aside instead of overwritten
+static void keeps_previous()
+{
+    {
+        log::ring_dest_t dest(log::level_t::trace, TEST_PATH, TEST_RECORDS);
+        deliver_message(dest, "previous run");
+    }
+
+    {
+        log::ring_dest_t dest(log::level_t::trace, TEST_PATH, TEST_RECORDS);
+        deliver_message(dest, "this run");
+    }
+
+    std::stringstream previous;
+    test_case(log::decode_ring_file(TEST_PATH JACKALOPE_LOG_RING_OLD_SUFFIX, previous) == 1);
+    test_case(previous.str().find("previous run") != std::string::npos);
+
+    std::stringstream current;
+    test_case(log::decode_ring_file(TEST_PATH, current) == 1);
+    test_case(current.str().find("this run") != std::string::npos);
+
+    std::remove(TEST_PATH);
+    std::remove(TEST_PATH JACKALOPE_LOG_RING_OLD_SUFFIX);
+}
+
+int main()
+{
+    start_testing(10);
+
+    run_test(round_trip);
+    run_test(wraps);
+    run_test(keeps_previous);
+}
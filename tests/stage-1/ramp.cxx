@@ -0,0 +1,67 @@
+// Jackalope Audio Engine
+// Copyright 2019 Tyler Riddle <kg7oem@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+
+#include <jackalope/ramp.h>
+
+#include "tests.h"
+
+using namespace jackalope;
+
+#define TEST_SAMPLE_RATE 100
+
+static void steady()
+{
+    ramp_t ramp;
+    real_t values[4];
+
+    ramp.fill(values, 4, TEST_SAMPLE_RATE, 1);
+    test_case(ramp.is_steady(1));
+    test_case(values[0] == 1 && values[3] == 1);
+}
+
+static void points()
+{
+    ramp_t ramp;
+    real_t values[8];
+
+    ramp.reset(0);
+    ramp.set_points({ { 4, 0.04 }, { 0, 0 } });
+
+    ramp.fill(values, 4, TEST_SAMPLE_RATE, 0);
+    test_case(values[0] == 1 && values[3] == 4);
+
+    ramp.fill(values, 2, TEST_SAMPLE_RATE, 0);
+    test_case(values[0] == 0 && values[1] == 0);
+    test_case(ramp.is_steady(0));
+}
+
+static void smoothing()
+{
+    ramp_t ramp;
+
+    ramp.smoothing_seconds = 0.02;
+    ramp.reset(0);
+
+    test_case(! ramp.is_steady(2));
+    test_case(ramp.advance(1, TEST_SAMPLE_RATE, 2) == 1);
+    test_case(ramp.advance(4, TEST_SAMPLE_RATE, 2) == 2);
+}
+
+int main()
+{
+    start_testing(8);
+
+    run_test(steady);
+    run_test(points);
+    run_test(smoothing);
+}
@@ -0,0 +1,169 @@
+// Jackalope Audio Engine
+// Copyright 2019 Tyler Riddle <kg7oem@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <jackalope/graph.h>
+#include <jackalope/shm.h>
+
+#include "tests.h"
+
+using namespace jackalope;
+
+#define TEST_MAX_SLOTS 64
+
+static string_t segment_name()
+{
+    return to_string("/jackalope-test-", getpid());
+}
+
+// maps the segment the way an outside reader would
+struct reader_t {
+    size_t size = 0;
+    const shm_header_t * header = nullptr;
+    const shm_slot_t * slots = nullptr;
+
+    reader_t(const string_t& name_in)
+    {
+        auto fd = shm_open(name_in.c_str(), O_RDONLY, 0);
+        assert(fd != -1);
+
+        struct stat file_stat;
+        fstat(fd, &file_stat);
+        size = file_stat.st_size;
+
+        auto memory = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+        close(fd);
+        assert(memory != MAP_FAILED);
+
+        header = static_cast<const shm_header_t *>(memory);
+        slots = reinterpret_cast<const shm_slot_t *>(header + 1);
+    }
+
+    ~reader_t()
+    {
+        munmap(const_cast<shm_header_t *>(header), size);
+    }
+
+    const shm_slot_t * find(const char * name_in)
+    {
+        for(size_t i = 0; i < header->num_slots; i++) {
+            if (std::strcmp(slots[i].name, name_in) == 0) {
+                return &slots[i];
+            }
+        }
+
+        return nullptr;
+    }
+};
+
+static shared_t<node_t> make_gain(shared_t<graph_t> graph_in, const string_t& name_in)
+{
+    return guard_object(graph_in, {
+        return graph_in->make_node({
+            { "object.type", "audio::gain" },
+            { "node.name", name_in },
+            { "config.gain", "0" },
+            { "pcm.sample_rate", "48000" },
+            { "pcm.buffer_size", "128" },
+        });
+    });
+}
+
+static void layout()
+{
+    shm_segment_t segment(segment_name(), TEST_MAX_SLOTS);
+    reader_t reader(segment_name());
+
+    test_case(reader.size == sizeof(shm_header_t) + sizeof(shm_slot_t) * TEST_MAX_SLOTS);
+    test_case(reader.header->magic == JACKALOPE_SHM_MAGIC && reader.header->version == JACKALOPE_SHM_VERSION);
+    test_case(reader.header->slot_size == sizeof(shm_slot_t) && reader.header->max_slots == TEST_MAX_SLOTS);
+    test_case(reader.header->num_slots == 0 && reader.header->table_version == 0);
+
+    auto graph = graph_t::make(init_args_t());
+    segment.rebuild({ make_gain(graph, "gain") });
+
+    auto gain = reader.find("gain/config.gain");
+    auto rate = reader.find("gain/pcm.sample_rate");
+
+    test_case(reader.header->num_slots > 0 && reader.header->table_version == 2);
+    test_case(gain != nullptr && gain->flags == JACKALOPE_SHM_SLOT_WRITABLE);
+    test_case(rate != nullptr && rate->flags == 0);
+}
+
+// a table that does not fit leaves the old one and an even version
+static void out_of_slots()
+{
+    shm_segment_t segment(segment_name(), 1);
+    reader_t reader(segment_name());
+    auto graph = graph_t::make(init_args_t());
+    bool threw = false;
+
+    try {
+        segment.rebuild({ make_gain(graph, "gain") });
+    } catch (const std::runtime_error&) {
+        threw = true;
+    }
+
+    test_case(threw);
+    test_case(reader.header->num_slots == 0 && reader.header->table_version == 0);
+}
+
+// a node that does not fit in the segment of a running graph is not added
+static void graph_out_of_slots()
+{
+    auto graph = graph_t::make({
+        { JACKALOPE_GRAPH_ARG_SHM_NAME, segment_name() },
+        { JACKALOPE_GRAPH_ARG_SHM_SLOTS, "1" },
+    });
+    bool threw = false;
+
+    guard_object(graph, { graph->start(); });
+
+    try {
+        make_gain(graph, "gain");
+    } catch (const std::runtime_error&) {
+        threw = true;
+    }
+
+    test_case(threw);
+
+    threw = false;
+
+    guard_object(graph, {
+        try {
+            graph->get_node("gain");
+        } catch (const std::runtime_error&) {
+            threw = true;
+        }
+
+        graph->stop();
+    });
+
+    test_case(threw);
+}
+
+int main()
+{
+    start_testing(11);
+
+    init();
+
+    run_test(layout);
+    run_test(out_of_slots);
+    run_test(graph_out_of_slots);
+}